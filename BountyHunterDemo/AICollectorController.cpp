@@ -7,31 +7,32 @@
 #include "AICollectorController.h"
 
 #include "PlayerSystem.h"
+#ifndef HEADLESS_SIMULATION
 #include "RenderSystem.h" // debug draw
+#endif
 
 AICollectorController::AICollectorController(const GameObjectId collectorId, const PlayerId playerId, const AICollectorControllerDesc& desc) : 
 	AIController(collectorId),
 	m_AICD(desc),
 	m_MyStash(nullptr),
 	m_TargetedBounty(nullptr),
-	m_isDead(false)
+	m_isDead(false),
+	m_HasSteeringRequest(false),
+	m_Random((unsigned int)std::rand())
 {
-	RegisterEventCallbacks();
-
-
 	// get collector's stash and stash position
 	Player* player = ECS::ECS_Engine->GetSystemManager()->GetSystem<PlayerSystem>()->GetPlayer(playerId);
 	this->m_MyStash = (Stash*)ECS::ECS_Engine->GetEntityManager()->GetEntity(player->GetStash());
-	this->m_MyStashPosition = this->m_MyStash->GetComponent<TransformComponent>()->AsTransform()->GetPosition();
+	this->m_MyStashPosition = this->m_MyStash->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition();
+
+	this->m_NavigationSystem = ECS::ECS_Engine->GetSystemManager()->GetSystem<NavigationSystem>();
 
 
 	// add BountyRadar to collector entity
 	this->m_BountyRadar = ECS::ECS_Engine->GetComponentManager()->AddComponent<BountyRadar>(collectorId, AI_VIEW_DISTANCE_BOUNTY, AI_BOUNTY_RADAR_LOS);
-	this->m_BountyRadar->Initialize();
 
 	// add CollectorAvoider to collector entity
-	this->m_CollectorAvoider = ECS::ECS_Engine->GetComponentManager()->AddComponent<CollectorAvoider>(collectorId, AI_VIEW_DISTANCE_OBSTACLE, ECS::ECS_Engine->GetComponentManager()->GetComponent<TransformComponent>(collectorId)->AsTransform()->GetScale().x);
-	this->m_CollectorAvoider->Initialize();
+	this->m_CollectorAvoider = ECS::ECS_Engine->GetComponentManager()->AddComponent<CollectorAvoider>(collectorId, AI_VIEW_DISTANCE_OBSTACLE, ECS::ECS_Engine->GetComponentManager()->GetComponent<TransformComponent>(collectorId)->GetScale().x);
 
 	this->m_Pawn->SetPlayer(playerId);
 	ChangeState(SPAWNED);
@@ -46,28 +47,16 @@ AICollectorController::~AICollectorController()
 }
 
 
-void AICollectorController::RegisterEventCallbacks()
-{
-	RegisterEventCallback(&AICollectorController::OnGameObjectKilled);
-	RegisterEventCallback(&AICollectorController::OnGameObjectSpawned);
-}
-
-void AICollectorController::OnGameObjectKilled(const GameObjectKilled* event)
+void AICollectorController::OnPossessedKilled()
 {
-	if (event->m_EntityID == this->m_Pawn->GetEntityID())
-	{
-		this->m_isDead = true;
-	}
+	this->m_isDead = true;
 }
 
-void AICollectorController::OnGameObjectSpawned(const GameObjectSpawned* event)
+void AICollectorController::OnPossessedSpawned()
 {
-	if (event->m_EntityID == this->m_Pawn->GetEntityID())
-	{
-		ResetFSM();
-		ChangeState(SPAWNED);
-		this->m_isDead = false;
-	}
+	ResetFSM();
+	ChangeState(SPAWNED);
+	this->m_isDead = false;
 }
 
 
@@ -79,16 +68,33 @@ void AICollectorController::OnGameObjectSpawned(const GameObjectSpawned* event)
 
 
 void AICollectorController::Update(float dt)
+{
+	// not updated concurrently, apply commands right away
+	UpdateConcurrent(dt, this->m_Commands);
+	this->m_Commands.Apply();
+}
+
+void AICollectorController::UpdateConcurrent(float dt, ControllerCommandBuffer& commands)
 {
 	if (this->m_isDead == false)
 	{
 		// Update FSM
 		UpdateStateMachine();
 
-		if (DEBUG_DRAWING_ENABLED == true)
+		// record steering request, the steering of all collectors is computed after all controllers are updated
+		if (this->m_HasSteeringRequest == true)
+		{
+			commands.Steer(this->m_Pawn, this->m_SteeringRequest);
+			this->m_HasSteeringRequest = false;
+		}
+
+#ifndef HEADLESS_SIMULATION
+		// gizmos are only drawn on rendered ticks
+		if (DEBUG_DRAWING_ENABLED == true && ECS::ECS_Engine->GetSystemManager()->IsSystemEnabled<RenderSystem>() == true)
 		{
-			this->DrawGizmos();
+			commands.DrawGizmos(this);
 		}
+#endif
 	}
 }
 
@@ -100,6 +106,7 @@ void AICollectorController::Update(float dt)
 
 void AICollectorController::DrawGizmos()
 {
+#ifndef HEADLESS_SIMULATION
 	static RenderSystem* RS = ECS::ECS_Engine->GetSystemManager()->GetSystem<RenderSystem>();
 
 	// draw bounty radar
@@ -112,7 +119,7 @@ void AICollectorController::DrawGizmos()
 	// draw threats
 	for (auto&& threat : this->m_CollectorAvoider->GetDetectedCollector())
 	{
-		RS->DrawLine(this->m_Pawn->GetComponent<TransformComponent>()->AsTransform()->GetPosition(), threat->GetComponent<TransformComponent>()->AsTransform()->GetPosition(), false, true, Color3f(1.0f, 0.0f, 0.0f));
+		RS->DrawLine(this->m_Pawn->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition(), threat->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition(), false, true, Color3f(1.0f, 0.0f, 0.0f));
 	}
 
 	switch (this->GetActiveState())
@@ -122,7 +129,7 @@ void AICollectorController::DrawGizmos()
 			// draw selected bounty
 			if (this->m_TargetedBounty != nullptr)
 			{
-				RS->DrawLine(this->m_Pawn->GetComponent<TransformComponent>()->AsTransform()->GetPosition(), this->m_TargetedBountyPosition, false, true, Color3f(0.0f, 1.0f, 0.0f));
+				RS->DrawLine(this->m_Pawn->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition(), this->m_TargetedBountyPosition, false, true, Color3f(0.0f, 1.0f, 0.0f));
 			}
 			break;
 		}
@@ -130,10 +137,11 @@ void AICollectorController::DrawGizmos()
 		case STASH_BOUNTY:
 		{
 			// draw selected bounty
-			RS->DrawLine(this->m_Pawn->GetComponent<TransformComponent>()->AsTransform()->GetPosition(), this->m_MyStashPosition, false, true, Color3f(0.0f, 1.0f, 0.0f));
+			RS->DrawLine(this->m_Pawn->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition(), this->m_MyStashPosition, false, true, Color3f(0.0f, 1.0f, 0.0f));
 			break;
 		}
 	}
+#endif
 }
 
 bool AICollectorController::AvoidObstacles()
@@ -144,17 +152,17 @@ bool AICollectorController::AvoidObstacles()
 	if (threat == threatEnd)
 		return false;
 
-	// Get Collector and bounty transform
-	auto collectorTF = this->m_Pawn->GetComponent<TransformComponent>();
+	// Get Collector transform
+	auto collectorTF = this->m_Pawn->GetTransform();
 
 	// determine closest threat
 	auto closestThreat = threat;
-	float sqD = glm::distance2(Position2D((*closestThreat)->GetComponent<TransformComponent>()->AsTransform()->GetPosition()), Position2D(collectorTF->AsTransform()->GetPosition()));
+	float sqD = glm::distance2(Position2D((*closestThreat)->GetTransform()->AsTransform2D()->GetPosition()), Position2D(collectorTF->AsTransform2D()->GetPosition()));
 	++threat;
 
 	for (threat; threat != threatEnd; ++threat)
 	{
-		float sqd = glm::distance2(Position2D((*threat)->GetComponent<TransformComponent>()->AsTransform()->GetPosition()), Position2D(collectorTF->AsTransform()->GetPosition()));
+		float sqd = glm::distance2(Position2D((*threat)->GetTransform()->AsTransform2D()->GetPosition()), Position2D(collectorTF->AsTransform2D()->GetPosition()));
 		if (sqd < sqD)
 		{
 			sqD = sqd;
@@ -165,26 +173,11 @@ bool AICollectorController::AvoidObstacles()
 
 	// try to steer in oposite direction the threat is facing ...
 
-	glm::vec2 myHeading = glm::normalize(collectorTF->AsTransform()->GetRight());
-
-	glm::vec2 threatHeadingNegative = -glm::normalize((*closestThreat)->GetComponent<TransformComponent>()->AsTransform()->GetRight());
-
-	float dot = glm::dot(myHeading, threatHeadingNegative);
+	glm::vec2 threatHeadingNegative = -glm::normalize((*closestThreat)->GetTransform()->AsTransform2D()->GetRight());
 
 	float steering = this->m_AICD.m_SteeringRatio_Avoid * COLLECTOR_MAX_TURN_SPEED;
-	float speedRatio = 0.0f;
-	if (glm::sign(dot) < 0.0f)
-	{
-		this->m_Pawn->TurnLeft(glm::abs(dot) * steering);
-		speedRatio = dot;
-	}
-	else
-	{
-		this->m_Pawn->TurnRight(glm::abs(dot) * steering);
-		speedRatio = dot;
-	}
 
-	this->m_Pawn->MoveForward(speedRatio * COLLECTOR_MAX_MOVE_SPEED);
+	this->Steer(SteeringRequest(STEER_AVOID, threatHeadingNegative, steering));
 
 	return true;
 }
@@ -192,32 +185,17 @@ bool AICollectorController::AvoidObstacles()
 float AICollectorController::MoveToTarget(const Position2D & target)
 {
 
-	// Get Collector and bounty transform
-	auto collectorTF = this->m_Pawn->GetComponent<TransformComponent>();
-
-	if (AvoidObstacles() == true)
-		return glm::distance2(target, Position2D(collectorTF->AsTransform()->GetPosition()));
-
-	glm::vec2 F = glm::normalize(collectorTF->AsTransform()->GetRight());
-	glm::vec2 T = glm::normalize(target - Position2D(collectorTF->AsTransform()->GetPosition()));
-	float dot = glm::dot(F, T);
+	// Get Collector transform
+	auto collectorTF = this->m_Pawn->GetTransform();
 
-	float steering = this->m_AICD.m_SteeringRatio_Target * COLLECTOR_MAX_TURN_SPEED;
-	float speedRatio = 0.0f;
-	if (glm::sign(dot) < 0.0f)
-	{
-		this->m_Pawn->TurnLeft(glm::abs(dot) * steering);
-		speedRatio = 1.0f + dot;
-	}
-	else
+	if (AvoidObstacles() == false)
 	{
-		this->m_Pawn->TurnRight(glm::abs(dot) * steering);
-		speedRatio = 1.0f - dot;
-	}
+		float steering = this->m_AICD.m_SteeringRatio_Target * COLLECTOR_MAX_TURN_SPEED;
 
-	this->m_Pawn->MoveForward(speedRatio * COLLECTOR_MAX_MOVE_SPEED);
+		this->Steer(SteeringRequest(STEER_SEEK, target, steering));
+	}
 
-	return glm::distance2(target, Position2D(collectorTF->AsTransform()->GetPosition()));
+	return glm::distance2(target, Position2D(collectorTF->AsTransform2D()->GetPosition()));
 }
 
 
@@ -228,7 +206,7 @@ float AICollectorController::MoveToTarget(const Position2D & target)
 void AICollectorController::S_SPAWNED()
 {
 	this->m_TargetedBounty = nullptr;
-	this->m_Pawn->Stop();
+	this->Steer(SteeringRequest(STEER_STOP));
 	ChangeState(FIND_BOUNTY);
 }
 
@@ -252,7 +230,15 @@ void AICollectorController::S_FIND_BOUNTY()
 	assert(this->m_TargetedBounty == nullptr && "AI controller is in invalid state!");
 
 	// Use bounty collect strategy to get next bounty to collect ...
-	Bounty* nextTarget = (Bounty*)BountyCollectStrategies[this->m_AICD.m_BountyCollectStrategy](this->m_Pawn, this->m_BountyRadar->GetDetectedBounty());
+	BountyCollectQuery query;
+	query.m_Candidates			= &this->m_BountyRadar->GetDetectedBounty();
+	query.m_Position			= this->m_Pawn->GetTransform()->AsTransform2D()->GetPosition();
+	query.m_PocketFill			= this->m_Pawn->GetCollectedBounty() / PLAYER_POCKET_SIZE;
+	query.m_DistanceExponent	= this->m_AICD.m_DistanceExponent;
+	query.m_PocketFillWeight	= this->m_AICD.m_PocketFillWeight;
+	query.m_Scoring				= &this->m_BountyScoring;
+
+	Bounty* nextTarget = (Bounty*)GetBountyCollectStrategy(this->m_AICD.m_BountyCollectStrategy)(query);
 	if (nextTarget == nullptr)
 	{
 		ChangeState(WANDER);
@@ -260,7 +246,7 @@ void AICollectorController::S_FIND_BOUNTY()
 	else
 	{
 		this->m_TargetedBounty = nextTarget;
-		this->m_TargetedBountyPosition = nextTarget->GetComponent<TransformComponent>()->AsTransform()->GetPosition();
+		this->m_TargetedBountyPosition = nextTarget->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition();
 		ChangeState(MOVE_TO_BOUNTY);
 	}
 }
@@ -282,7 +268,7 @@ void AICollectorController::S_FIND_BOUNTY_LEAVE()
 void AICollectorController::S_WANDER()
 {
 	// roll the dice, if random value exceeds a given chance: chnage back to FIND_BOUNTY state
-	if (glm::linearRand(0.0f, 1.0f) > this->m_AICD.m_WanderStateStayChance)
+	if (this->Random() > this->m_AICD.m_WanderStateStayChance)
 	{
 		ChangeState(FIND_BOUNTY);
 		return;
@@ -293,22 +279,16 @@ void AICollectorController::S_WANDER()
 	if (AvoidObstacles() == true)
 		return;
 
-	this->m_Pawn->StopTurning();
-
-	// move full speed ahead
-	this->m_Pawn->MoveForward(COLLECTOR_MAX_MOVE_SPEED);
-
 	float steering = this->m_AICD.m_SteeringRatio_Wander * COLLECTOR_MAX_TURN_SPEED;
 
-	// steer to the left
-	if (glm::linearRand(0.0f, 1.0f) > 0.5f)
+	// move full speed ahead and steer to the left or right
+	if (this->Random() > 0.5f)
 	{
-		this->m_Pawn->TurnLeft(steering);
+		this->Steer(SteeringRequest(STEER_WANDER_LEFT, glm::vec2(0.0f), steering));
 	}
-	// steer to the right
 	else
 	{
-		this->m_Pawn->TurnRight(steering);
+		this->Steer(SteeringRequest(STEER_WANDER_RIGHT, glm::vec2(0.0f), steering));
 	}
 }
 
@@ -341,7 +321,7 @@ void AICollectorController::S_MOVE_TO_BOUNTY()
 
 void AICollectorController::S_MOVE_TO_BOUNTY_ENTER()
 {
-	this->m_Pawn->Stop();
+	this->Steer(SteeringRequest(STEER_STOP));
 	//SDL_Log("Player #%d - entered 'MOVE_TO_BOUNTY' state.", this->m_Pawn->GetPlayer());
 }
 
@@ -388,6 +368,19 @@ void AICollectorController::S_BOUNTY_COLLECTED_LEAVE()
 
 void AICollectorController::S_STASH_BOUNTY()
 {
+	const Position2D position = this->m_Pawn->GetTransform()->AsTransform2D()->GetPosition();
+
+	// follow the stash's flow field, it already leads around other collectors
+	glm::vec2 flow;
+	if (this->m_NavigationSystem->GetFlowDirection(this->m_Pawn->GetPlayer(), position, flow) == true)
+	{
+		float steering = this->m_AICD.m_SteeringRatio_Target * COLLECTOR_MAX_TURN_SPEED;
+
+		this->Steer(SteeringRequest(STEER_SEEK, position + flow * NAVIGATION_GRID_CELL_SIZE, steering));
+		return;
+	}
+
+	// in the stash's cell (or no field yet), move straight to it
 	if (this->MoveToTarget(this->m_MyStashPosition) <= 0.33f)
 		ChangeState(FIND_BOUNTY);
 }
@@ -14,23 +14,31 @@
 
 #include "AICollectorControllerDesc.h"
 
-#include "SimpleFSM.h"
+#include "StaticFSM.h"
 
 #include "BountyRadar.h"
 #include "CollectorAvoider.h"
 
-class AICollectorController : public AIController<Collector>, public SimpleFSM
+#include "NavigationSystem.h"
+
+#include "ControllerCommandBuffer.h"
+
+#include <random>
+
+enum AICollectorControllerStates
 {
+	SPAWNED = 0,
+	FIND_BOUNTY,
+	WANDER,
+	MOVE_TO_BOUNTY,
+	BOUNTY_COLLECTED,
+	STASH_BOUNTY,
 
-	enum AICollectorControllerStates
-	{
-		SPAWNED = 0,
-		FIND_BOUNTY,
-		WANDER,
-		MOVE_TO_BOUNTY,
-		BOUNTY_COLLECTED,
-		STASH_BOUNTY
-	}; // enum AICollectorControllerStates
+	MAX_AI_COLLECTOR_CONTROLLER_STATES
+}; // enum AICollectorControllerStates
+
+class AICollectorController : public AIController<Collector>, public StaticFSM<AICollectorController, AICollectorControllerStates, MAX_AI_COLLECTOR_CONTROLLER_STATES, 1>
+{
 
 	///-------------------------------------------------------------------------------------------------
 	/// Summary:	AI Collector Controller State Transitions.
@@ -64,31 +72,43 @@ class AICollectorController : public AIController<Collector>, public SimpleFSM
 	///-------------------------------------------------------------------------------------------------
 
 
+	// Define FSM State table
+	BEGIN_FSM_STATE_TABLE
+
+		FSM_STATE(SPAWNED			, &AICollectorController::S_SPAWNED			, &AICollectorController::S_SPAWNED_ENTER			, &AICollectorController::S_SPAWNED_LEAVE)
+		FSM_STATE(FIND_BOUNTY		, &AICollectorController::S_FIND_BOUNTY		, &AICollectorController::S_FIND_BOUNTY_ENTER		, &AICollectorController::S_FIND_BOUNTY_LEAVE)
+		FSM_STATE(WANDER			, &AICollectorController::S_WANDER			, &AICollectorController::S_WANDER_ENTER			, &AICollectorController::S_WANDER_LEAVE)
+		FSM_STATE(MOVE_TO_BOUNTY	, &AICollectorController::S_MOVE_TO_BOUNTY	, &AICollectorController::S_MOVE_TO_BOUNTY_ENTER	, &AICollectorController::S_MOVE_TO_BOUNTY_LEAVE)
+		FSM_STATE(BOUNTY_COLLECTED	, &AICollectorController::S_BOUNTY_COLLECTED	, &AICollectorController::S_BOUNTY_COLLECTED_ENTER	, &AICollectorController::S_BOUNTY_COLLECTED_LEAVE)
+		FSM_STATE(STASH_BOUNTY		, &AICollectorController::S_STASH_BOUNTY		, &AICollectorController::S_STASH_BOUNTY_ENTER		, &AICollectorController::S_STASH_BOUNTY_LEAVE)
+
+	END_FSM_STATE_TABLE
+
 	// Define FSM Transition table
-	BEGIN_TRANSITION_TABLE
+	BEGIN_FSM_TRANSITION_TABLE
 
 		// Initial State
-		TRANSITION_ENTRY(NULL_STATE									, AICollectorController::S_SPAWNED			, AICollectorController::S_SPAWNED_ENTER			, NO_ONLEAVE_PROC									, SPAWNED)
+		FSM_INITIAL_TRANSITION(SPAWNED)
 
 		// Transitions to 'FIND_BOUNTY'
-		TRANSITION_ENTRY(AICollectorController::S_SPAWNED			, AICollectorController::S_FIND_BOUNTY		, AICollectorController::S_FIND_BOUNTY_ENTER		, AICollectorController::S_SPAWNED_LEAVE			, FIND_BOUNTY)
-		TRANSITION_ENTRY(AICollectorController::S_WANDER			, AICollectorController::S_FIND_BOUNTY		, AICollectorController::S_FIND_BOUNTY_ENTER		, AICollectorController::S_WANDER_LEAVE				, FIND_BOUNTY)
-		TRANSITION_ENTRY(AICollectorController::S_BOUNTY_COLLECTED	, AICollectorController::S_FIND_BOUNTY		, AICollectorController::S_FIND_BOUNTY_ENTER		, AICollectorController::S_BOUNTY_COLLECTED_LEAVE	, FIND_BOUNTY)
-		TRANSITION_ENTRY(AICollectorController::S_STASH_BOUNTY		, AICollectorController::S_FIND_BOUNTY		, AICollectorController::S_FIND_BOUNTY_ENTER		, AICollectorController::S_STASH_BOUNTY_LEAVE		, FIND_BOUNTY)
+		FSM_TRANSITION(SPAWNED			, FIND_BOUNTY)
+		FSM_TRANSITION(WANDER			, FIND_BOUNTY)
+		FSM_TRANSITION(BOUNTY_COLLECTED	, FIND_BOUNTY)
+		FSM_TRANSITION(STASH_BOUNTY		, FIND_BOUNTY)
 
 		// Transitions to 'WANDER'
-		TRANSITION_ENTRY(AICollectorController::S_FIND_BOUNTY		, AICollectorController::S_WANDER			, AICollectorController::S_WANDER_ENTER				, AICollectorController::S_FIND_BOUNTY_LEAVE		, WANDER)
+		FSM_TRANSITION(FIND_BOUNTY		, WANDER)
 
 		// Transitions to 'MOVE_TO_BOUNTY'
-		TRANSITION_ENTRY(AICollectorController::S_FIND_BOUNTY		, AICollectorController::S_MOVE_TO_BOUNTY	, AICollectorController::S_MOVE_TO_BOUNTY_ENTER		, AICollectorController::S_FIND_BOUNTY_LEAVE		, MOVE_TO_BOUNTY)
+		FSM_TRANSITION(FIND_BOUNTY		, MOVE_TO_BOUNTY)
 
 		// Transitions to 'BOUNTY_COLLECTED'
-		TRANSITION_ENTRY(AICollectorController::S_MOVE_TO_BOUNTY	, AICollectorController::S_BOUNTY_COLLECTED	, AICollectorController::S_BOUNTY_COLLECTED_ENTER	, AICollectorController::S_MOVE_TO_BOUNTY_LEAVE		, BOUNTY_COLLECTED)
+		FSM_TRANSITION(MOVE_TO_BOUNTY	, BOUNTY_COLLECTED)
 
 		// Transitions to 'STASH_BOUNTY'
-		TRANSITION_ENTRY(AICollectorController::S_BOUNTY_COLLECTED	, AICollectorController::S_STASH_BOUNTY		, AICollectorController::S_STASH_BOUNTY_ENTER		, AICollectorController::S_BOUNTY_COLLECTED_LEAVE	, STASH_BOUNTY)
+		FSM_TRANSITION(BOUNTY_COLLECTED	, STASH_BOUNTY)
 
-	END_TRANSITION_TABLE
+	END_FSM_TRANSITION_TABLE
 
 
 	// FSM State callback functions
@@ -124,17 +144,10 @@ class AICollectorController : public AIController<Collector>, public SimpleFSM
 	void S_STASH_BOUNTY_LEAVE();
 
 
-	void RegisterEventCallbacks();
-
-	void OnGameObjectKilled(const GameObjectKilled* event);
-	void OnGameObjectSpawned(const GameObjectSpawned* event);
-
-	void DrawGizmos();
-
 	///-------------------------------------------------------------------------------------------------
 	/// Fn:	bool AICollectorController::AvoidObstacles();
 	///
-	/// Summary:	Checks if there are obstacles and trys to avoid them.
+	/// Summary:	Checks if there are obstacles and requests steering to avoid them.
 	///
 	/// Author:	Tobias Stein
 	///
@@ -148,7 +161,7 @@ class AICollectorController : public AIController<Collector>, public SimpleFSM
 	///-------------------------------------------------------------------------------------------------
 	/// Fn:	float AICollectorController::MoveToTarget(const Position2D& target);
 	///
-	/// Summary:	Moves the collector to target.
+	/// Summary:	Requests steering to move the collector to target, unless it has to avoid obstacles.
 	///
 	/// Author:	Tobias Stein
 	///
@@ -162,12 +175,37 @@ class AICollectorController : public AIController<Collector>, public SimpleFSM
 
 	float MoveToTarget(const Position2D& target);
 
+	// requests how the collector steers this tick, the last request of a tick wins
+	inline void Steer(const SteeringRequest& request)
+	{
+		this->m_SteeringRequest = request;
+		this->m_HasSteeringRequest = true;
+	}
+
 	AICollectorControllerDesc	m_AICD;
 
 	BountyRadar*				m_BountyRadar;
 
 	CollectorAvoider*			m_CollectorAvoider;
 
+	// flow fields to the stashes
+	const NavigationSystem*		m_NavigationSystem;
+
+	// scratch space of the bounty collect strategy
+	BountyScoring				m_BountyScoring;
+
+	SteeringRequest				m_SteeringRequest;
+	bool						m_HasSteeringRequest;
+
+	// commands of a serial update, reused so recording them does not allocate each tick
+	ControllerCommandBuffer		m_Commands;
+
+	// own random engine, std::rand is shared by all threads
+	std::minstd_rand			m_Random;
+
+	// random value in [0, 1)
+	inline float Random() { return std::uniform_real_distribution<float>(0.0f, 1.0f)(this->m_Random); }
+
 	
 	bool						m_isDead;
 
@@ -187,6 +225,17 @@ public:
 	// Inherited via AIController
 	virtual void Update(float dt) override;
 
+	// the ai only reads the world and records the steering of its collector
+	virtual bool IsConcurrent() const override { return true; }
+
+	virtual void UpdateConcurrent(float dt, ControllerCommandBuffer& commands) override;
+
+	virtual void OnPossessedKilled() override;
+
+	virtual void OnPossessedSpawned() override;
+
+	virtual void DrawGizmos() override;
+
 }; // class AICollectorController
 
 #endif // __AI_COLLECTOR_CONTROLLER_H__
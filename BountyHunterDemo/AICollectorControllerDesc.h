@@ -25,6 +25,12 @@ struct AICollectorControllerDesc
 	/// Summary:	The bounty collection strategy.
 	BountyCollectStrategyType	m_BountyCollectStrategy;
 
+	/// Summary:	The exponent k of the distance in the DISTANCE_VS_VALUE_STRATEGY utility (value / distance^k).
+	float						m_DistanceExponent;
+
+	/// Summary:	How much more distance matters with a full pocket in the DISTANCE_VS_VALUE_STRATEGY utility.
+	float						m_PocketFillWeight;
+
 	/// Summary:	This marks the propability to remain in WANDER state, else change back to FIND_BOUNTY state.
 	float						m_WanderStateStayChance;
 
@@ -52,6 +58,8 @@ struct AICollectorControllerDesc
 
 	AICollectorControllerDesc() :
 		m_BountyCollectStrategy(BountyCollectStrategyType::FIRST_STRATEGY),
+		m_DistanceExponent(1.0f),
+		m_PocketFillWeight(1.0f),
 		m_WanderStateStayChance(0.5f),
 		m_SteeringRatio_Wander(0.5f),
 		m_SteeringRatio_Target(1.0f),
@@ -24,7 +24,7 @@ Bounty::Bounty(GameObjectId spawnId)
 	AddComponent<RespawnComponent>(BOUNTY_RESPAWNTIME, spawnId, true);
 	this->m_ThisRigidbody = AddComponent<RigidbodyComponent>(0.0f, 0.0f, 0.0f, 0.0f, 0.0001f);
 	this->m_ThisTransform = GetComponent<TransformComponent>();
-	this->m_ThisCollision = AddComponent<CollisionComponent2D>(shape, this->m_ThisTransform->AsTransform()->GetScale(), CollisionCategory::Bounty_Category, CollisionMask::Bounty_Collision);
+	this->m_ThisCollision = AddComponent<CollisionComponent2D>(shape, this->m_ThisTransform->GetScale(), CollisionCategory::Bounty_Category, CollisionMask::Bounty_Collision);
 	this->m_ThisLifetime = AddComponent<LifetimeComponent>(BOUNTY_MIN_LIFETIME, BOUNTY_MAX_LIFETIME);
 }
 
@@ -38,7 +38,7 @@ void Bounty::OnEnable()
 
 	this->m_ThisLifetime->ResetLifetime();
 
-	this->m_ThisRigidbody->SetTransform(*this->m_ThisTransform->AsTransform());
+	this->m_ThisRigidbody->SetTransform(*this->m_ThisTransform->AsTransform2D());
 	this->m_ThisRigidbody->m_Box2DBody->SetLinearVelocity(b2Vec2_zero);
 	this->m_ThisRigidbody->m_Box2DBody->SetAngularVelocity(0.0f);
 	this->m_ThisRigidbody->m_Box2DBody->SetActive(true);
@@ -57,7 +57,7 @@ void Bounty::ShuffleBounty()
 
 	float scale = glm::lerp(MIN_BOUNTY_SCALE, MAX_BOUNTY_SCALE, alpha) * GLOBAL_SCALE;
 
-	this->m_ThisTransform->AsTransform()->SetScale(glm::vec3(scale));
+	this->m_ThisTransform->SetScale(glm::vec2(scale));
 	this->m_ThisMaterial->SetColor(1.0f, 1.0f - alpha, 0.0f);
 	this->m_ThisRigidbody->SetScale(glm::vec2(scale));
 }
@@ -0,0 +1,62 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	BountyCollectStrategy.cpp.
+///
+/// Summary:	Implements the bounty collection strategies.
+///-------------------------------------------------------------------------------------------------
+
+#include "BountyCollectStrategy.h"
+
+#include <assert.h>
+
+static const Bounty* SelectBest(const BountyCollectQuery& query, const BountyUtility& utility)
+{
+	const size_t best = query.m_Scoring->SelectBest(*query.m_Candidates, query.m_Position, query.m_PocketFill, utility);
+
+	return best != BountyScoring::INVALID_CANDIDATE ? query.m_Candidates->m_Bounty[best] : nullptr;
+}
+
+static BountyCollectStrategy BountyCollectStrategies[BountyCollectStrategyType::MAX_COLLECT_STRATEGIES]
+{
+	/// Summary:	Always returns nullptr.
+	[](const BountyCollectQuery& query) -> const Bounty*
+	{
+		return nullptr;
+	},
+
+	/// Summary:	Always returns the first bounty of the provided list.
+	[](const BountyCollectQuery& query) -> const Bounty*
+	{
+		return query.m_Candidates->IsEmpty() == true ? nullptr : query.m_Candidates->m_Bounty.front();
+	},
+
+	/// Summary:	Returns the geograpcially closest bounty, utility is 1 / d.
+	[](const BountyCollectQuery& query) -> const Bounty*
+	{
+		return SelectBest(query, { 1.0f, 0.0f, 1.0f, 0.0f });
+	},
+
+	/// Summary:	Returns the bounty with the highest value, utility is v.
+	[](const BountyCollectQuery& query) -> const Bounty*
+	{
+		return SelectBest(query, { 0.0f, 1.0f, 0.0f, 0.0f });
+	},
+
+	/// Summary:	Distance vs. Value strategy. Returns the bounty with the highest value and lowest
+	/// distance, utility is v / d^k, where distance matters more the fuller the collector's pocket is.
+	[](const BountyCollectQuery& query) -> const Bounty*
+	{
+		return SelectBest(query, { 0.0f, 1.0f, query.m_DistanceExponent, query.m_PocketFillWeight });
+	}
+};
+
+const BountyCollectStrategy& GetBountyCollectStrategy(BountyCollectStrategyType type)
+{
+	assert(type < BountyCollectStrategyType::MAX_COLLECT_STRATEGIES && "Invalid bounty collect strategy!");
+	return BountyCollectStrategies[type];
+}
+
+void SetBountyCollectStrategy(BountyCollectStrategyType type, const BountyCollectStrategy& strategy)
+{
+	assert(type < BountyCollectStrategyType::MAX_COLLECT_STRATEGIES && "Invalid bounty collect strategy!");
+	BountyCollectStrategies[type] = strategy;
+}
@@ -7,8 +7,9 @@
 #ifndef __BOUNTY_COLLECT_STRATEGY_H__
 #define __BOUNTY_COLLECT_STRATEGY_H__
 
-#include "Collector.h"
-#include "Bounty.h"
+#include <functional>
+
+#include "BountyScoring.h"
 
 enum BountyCollectStrategyType
 {
@@ -21,87 +22,73 @@ enum BountyCollectStrategyType
 	MAX_COLLECT_STRATEGIES
 }; // enum BountyCollectStrategy
 
+///-------------------------------------------------------------------------------------------------
+/// Struct:	BountyCollectQuery
+///
+/// Summary:	Everything a bounty collect strategy gets to know. It does not reference any entity
+/// or component, so strategies can also be run (and timed) on made up candidates.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
 
+struct BountyCollectQuery
+{
+	/// Summary:	The bounty to choose from.
+	const BountyCandidates*		m_Candidates;
 
-/// Summary:	The bounty collect strategy. Returns a bounty from the given list of bounties
-/// w.r.t. a certain strategy. If no bounty can be determined a nulpltr is returned.
-using BountyCollectStrategy = std::function<const Bounty* (Collector*, const std::list<const Bounty*>&)>;
+	/// Summary:	Position of the collector.
+	Position2D					m_Position;
 
-static const BountyCollectStrategy BountyCollectStrategies[BountyCollectStrategyType::MAX_COLLECT_STRATEGIES]
-{
-	/// Summary:	Always returns nullptr.
-	[](Collector* collector, const std::list<const Bounty*>& bountyList) -> const Bounty*
-	{
-		return nullptr;
-	},
-
-	/// Summary:	Always returns the first bounty of the provided list.
-	[](Collector* collector, const std::list<const Bounty*>& bountyList) -> const Bounty*
-	{
-		return bountyList.empty() == true ? nullptr : bountyList.front();
-	},
-
-	/// Summary:	Returns the geograpcially closest bounty.
-	[](Collector* collector, const std::list<const Bounty*>& bountyList) -> const Bounty*
-	{
-		if (bountyList.empty() == true)
-			return nullptr;
-
-		Position2D collectorPosition = collector->GetComponent<TransformComponent>()->AsTransform()->GetPosition();
-
-		auto it = bountyList.begin();
-		Bounty* closestBounty = (Bounty*)(*it);
-		float D = glm::distance2(collectorPosition, Position2D(closestBounty->GetComponent<TransformComponent>()->AsTransform()->GetPosition()));
-		
-		++it;
-		for (it; it != bountyList.end(); ++it)
-		{
-			Bounty* bounty = (Bounty*)(*it);
-
-			float d = glm::distance2(collectorPosition, Position2D(bounty->GetComponent<TransformComponent>()->AsTransform()->GetPosition()));
-			if (d < D)
-			{
-				D = d;
-				closestBounty = bounty;
-			}
-		}
-
-		return closestBounty;
-	},
-
-	/// Summary:	Returns the bounty with the highest value.
-	[](Collector* collector, const std::list<const Bounty*>& bountyList) -> const Bounty*
-	{
-		if (bountyList.empty() == true)
-			return nullptr;
-
-		auto it = bountyList.begin();
-		Bounty* highestBounty = (Bounty*)(*it);
-		float V = highestBounty->GetBounty();
-
-		++it;
-		for (it; it != bountyList.end(); ++it)
-		{
-			float v = (*it)->GetBounty();
-			if (v < V)
-			{
-				V = v;
-				highestBounty = (Bounty*)(*it);
-			}
-		}
-
-		return highestBounty;
-	},
-
-	/// Summary:	Distance vs. Value strategy. Returns the bounty with the highest value and lowest distance.
-	[](Collector* collector, const std::list<const Bounty*>& bountyList) -> const Bounty*
-	{
-		if (bountyList.empty() == true)
-			return nullptr;		
-
-		assert(false && "Not implemented yet");
-		return nullptr;
-	}
-};
+	/// Summary:	Collected bounty w.r.t. the pocket size [0, 1].
+	float						m_PocketFill;
+
+	/// Summary:	Distance exponent and pocket fill weight of the DISTANCE_VS_VALUE_STRATEGY utility.
+	float						m_DistanceExponent;
+	float						m_PocketFillWeight;
+
+	/// Summary:	Scratch space of the scoring strategies, one per caller.
+	BountyScoring*				m_Scoring;
+
+}; // struct BountyCollectQuery
+
+/// Summary:	The bounty collect strategy. Returns a bounty from the given candidates w.r.t. a
+/// certain strategy. If no bounty can be determined a nullptr is returned.
+using BountyCollectStrategy = std::function<const Bounty* (const BountyCollectQuery&)>;
+
+///-------------------------------------------------------------------------------------------------
+/// Fn:	const BountyCollectStrategy& GetBountyCollectStrategy(BountyCollectStrategyType type);
+///
+/// Summary:	Gets the strategy currently registered for a strategy type.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///
+/// Parameters:
+/// type - 	The strategy type.
+///
+/// Returns:	The bounty collect strategy.
+///-------------------------------------------------------------------------------------------------
+
+const BountyCollectStrategy& GetBountyCollectStrategy(BountyCollectStrategyType type);
+
+///-------------------------------------------------------------------------------------------------
+/// Fn:	void SetBountyCollectStrategy(BountyCollectStrategyType type, const BountyCollectStrategy& strategy);
+///
+/// Summary:	Replaces the strategy of a strategy type, e.g. to try out a different implementation.
+/// Strategies are shared by all ai controllers, so only replace them while the game is not running.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///
+/// Parameters:
+/// type - 		The strategy type.
+/// strategy - 	The new strategy.
+///-------------------------------------------------------------------------------------------------
+
+void SetBountyCollectStrategy(BountyCollectStrategyType type, const BountyCollectStrategy& strategy);
 
 #endif // __BOUNTY_COLLECT_STRATEGY_H__
@@ -8,45 +8,29 @@
 #define __BOUNTY_RADAR_H__
 
 #include <ECS/ECS.h>
-#include "GameEvents.h"
-#include "WorldSystem.h"
+#include "GameTypes.h"
 
+#include "BountyScoring.h"
 
-
-class Collector;
-class Bounty;
-
-class BountyRadar : public ECS::Component<BountyRadar>, public ECS::Event::IEventListener
+// cone of view in which a collector can see bounty, the detected bounty is updated by the PerceptionSystem
+class BountyRadar : public ECS::Component<BountyRadar>
 {
-	using DetectedBounty = std::list<const Bounty*>;
-
-private:
-
-	void RegisterEventCallbacks();
+	friend class PerceptionSystem;
 
-	void OnCollisionBegin(const CollisionBeginEvent* event);
-	void OnCollisionEnd(const CollisionEndEvent* event);
+	using DetectedBounty = BountyCandidates;
 
-
-	void RadarAddBountyAction(Collector* collector, Bounty* bounty);
-	void RadarRemoveBountyAction(Collector* collector, Bounty* bounty);
+private:
 
 	DetectedBounty	m_DetectedBounty;
 
 	float			m_ViewDistance;
 	float			m_LOS;
 
-	b2PolygonShape	m_b2RadarShape;
-	b2Fixture*		m_Radar;
-
 public:	
 
 	BountyRadar(float viewDistance, float lineOfSight);
 	~BountyRadar();
 
-	void Initialize();
-	void Destroy();
-
 	///-------------------------------------------------------------------------------------------------
 	/// Fn:	inline const DetectedBounty& BountyRadar::GetDetectedBounty() const
 	///
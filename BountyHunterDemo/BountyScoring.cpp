@@ -0,0 +1,69 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	BountyScoring.cpp.
+///
+/// Summary:	Implements the bounty scoring class.
+///-------------------------------------------------------------------------------------------------
+
+#include "BountyScoring.h"
+
+// keeps d^k finite for a bounty right under the collector
+static constexpr float MIN_SQ_DISTANCE { 1.0e-4f };
+
+// U[i] = (BIAS + WEIGHT * V[i]) * factor(d^2)
+template<class DistanceFactor>
+static void EvaluateUtility(float* const __restrict U, const float* const __restrict PX, const float* const __restrict PY, const float* const __restrict V, size_t N, float CX, float CY, float BIAS, float WEIGHT, DistanceFactor factor)
+{
+	for (size_t i = 0; i < N; ++i)
+	{
+		const float dx = PX[i] - CX;
+		const float dy = PY[i] - CY;
+
+		U[i] = (BIAS + WEIGHT * V[i]) * factor(dx * dx + dy * dy + MIN_SQ_DISTANCE);
+	}
+}
+
+BountyScoring::BountyScoring()
+{}
+
+BountyScoring::~BountyScoring()
+{}
+
+size_t BountyScoring::SelectBest(const BountyCandidates& candidates, const Position2D& position, float pocketFill, const BountyUtility& utility)
+{
+	const size_t N = candidates.GetCount();
+	if (N == 0)
+		return INVALID_CANDIDATE;
+
+	this->m_Utility.resize(N);
+
+	// d^k = (d^2)^(k/2)
+	const float HALF_K		= -0.5f * utility.m_DistanceExponent * (1.0f + utility.m_PocketFillWeight * pocketFill);
+	const float BIAS		= utility.m_ValueBias;
+	const float WEIGHT		= utility.m_ValueWeight;
+	const float CX			= position.x;
+	const float CY			= position.y;
+
+	// plain pointers, so the compiler does not have to assume the arrays alias
+	const float* const __restrict PX = candidates.m_PositionX.data();
+	const float* const __restrict PY = candidates.m_PositionY.data();
+	const float* const __restrict V = candidates.m_Value.data();
+
+	float* const __restrict U = this->m_Utility.data();
+
+	// note: the exponents of the built-in strategies get a loop without powf, which the compiler
+	// can vectorize; any other exponent pays for a powf call per candidate
+	if (HALF_K == 0.0f)
+		EvaluateUtility(U, PX, PY, V, N, CX, CY, BIAS, WEIGHT, [](float) { return 1.0f; });
+	else if (HALF_K == -0.5f)
+		EvaluateUtility(U, PX, PY, V, N, CX, CY, BIAS, WEIGHT, [](float sqDistance) { return 1.0f / sqrtf(sqDistance); });
+	else if (HALF_K == -1.0f)
+		EvaluateUtility(U, PX, PY, V, N, CX, CY, BIAS, WEIGHT, [](float sqDistance) { return 1.0f / sqDistance; });
+	else
+		EvaluateUtility(U, PX, PY, V, N, CX, CY, BIAS, WEIGHT, [HALF_K](float sqDistance) { return powf(sqDistance, HALF_K); });
+
+	size_t best = 0;
+	for (size_t i = 1; i < N; ++i)
+		best = U[i] > U[best] ? i : best;
+
+	return best;
+}
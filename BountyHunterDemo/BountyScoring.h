@@ -0,0 +1,131 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	BountyScoring.h.
+///
+/// Summary:	Declares the bounty scoring class. Bounty candidates are packed into arrays of
+/// positions and values (filled by the PerceptionSystem), so a utility can be evaluated for all
+/// candidates in one branch-free loop without touching their components.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __BOUNTY_SCORING_H__
+#define __BOUNTY_SCORING_H__
+
+#include <vector>
+
+#include "math.h"
+
+class Bounty;
+
+///-------------------------------------------------------------------------------------------------
+/// Struct:	BountyCandidates
+///
+/// Summary:	Bounty candidates as structure of arrays, one entry per bounty.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+struct BountyCandidates
+{
+	std::vector<const Bounty*>	m_Bounty;
+
+	std::vector<float>			m_PositionX;
+	std::vector<float>			m_PositionY;
+
+	std::vector<float>			m_Value;
+
+	inline size_t GetCount() const { return this->m_Bounty.size(); }
+
+	inline bool IsEmpty() const { return this->m_Bounty.empty(); }
+
+	inline void Add(const Bounty* bounty, const Position2D& position, float value)
+	{
+		this->m_Bounty.push_back(bounty);
+		this->m_PositionX.push_back(position.x);
+		this->m_PositionY.push_back(position.y);
+		this->m_Value.push_back(value);
+	}
+
+	void Reserve(size_t capacity)
+	{
+		this->m_Bounty.reserve(capacity);
+		this->m_PositionX.reserve(capacity);
+		this->m_PositionY.reserve(capacity);
+		this->m_Value.reserve(capacity);
+	}
+
+	void Clear()
+	{
+		this->m_Bounty.clear();
+		this->m_PositionX.clear();
+		this->m_PositionY.clear();
+		this->m_Value.clear();
+	}
+
+}; // struct BountyCandidates
+
+///-------------------------------------------------------------------------------------------------
+/// Struct:	BountyUtility
+///
+/// Summary:	Coefficients of the utility of a bounty with value v at distance d from a collector,
+/// whose pocket is filled by pocketFill [0, 1]:
+///
+/// 			utility	= (valueBias + valueWeight * v) / d^k
+/// 			k		= distanceExponent * (1 + pocketFillWeight * pocketFill)
+///
+/// So the fuller the pocket, the more distance matters.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+struct BountyUtility
+{
+	float	m_ValueBias;
+	float	m_ValueWeight;
+	float	m_DistanceExponent;
+	float	m_PocketFillWeight;
+
+}; // struct BountyUtility
+
+class BountyScoring
+{
+private:
+
+	// utility of each candidate of the last evaluation
+	std::vector<float>	m_Utility;
+
+public:
+
+	static constexpr size_t INVALID_CANDIDATE { (size_t)-1 };
+
+	BountyScoring();
+	~BountyScoring();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	size_t BountyScoring::SelectBest(const BountyCandidates& candidates, const Position2D& position, float pocketFill, const BountyUtility& utility);
+	///
+	/// Summary:	Evaluates the utility of all candidates and returns the index of the candidate with
+	/// the highest utility. If there are several, the first one is returned.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// candidates - 	The candidates.
+	/// position - 		The collector's position.
+	/// pocketFill - 	The collector's pocket fill state [0, 1].
+	/// utility - 		The utility coefficients.
+	///
+	/// Returns:	Index of the best candidate, INVALID_CANDIDATE if there are no candidates.
+	///-------------------------------------------------------------------------------------------------
+
+	size_t SelectBest(const BountyCandidates& candidates, const Position2D& position, float pocketFill, const BountyUtility& utility);
+
+	inline const std::vector<float>& GetUtility() const { return this->m_Utility; }
+
+}; // class BountyScoring
+
+#endif // __BOUNTY_SCORING_H__
@@ -15,7 +15,7 @@ BountySpawn::BountySpawn(const Position & position, const glm::vec2& halfExpand,
 	AddComponent<MaterialComponent>(MaterialGenerator::CreateMaterial<DefaultMaterial>(), Color4f(1.0f, 1.0f, 0.0f, 0.2f));
 
 	TransformComponent* thisTransformComponent = GetComponent<TransformComponent>();
-	thisTransformComponent->SetScale(glm::vec3(halfExpand, 0.0f));
+	thisTransformComponent->SetScale(halfExpand);
 #endif // DEBUG_SHOW_SPAWNS
 }
 
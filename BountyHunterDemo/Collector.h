@@ -54,6 +54,10 @@ public:
 
 	inline float GetCollectedBounty() const { return this->m_CollectedBounty; }
 
+	inline const TransformComponent* GetTransform() const { return this->m_ThisTransform; }
+
+	inline RigidbodyComponent* GetRigidbody() const { return this->m_ThisRigidbody; }
+
 	void MoveForward(float speed);
 	void TurnLeft(float degrees);
 	void TurnRight(float degrees);
@@ -9,41 +9,31 @@
 #define __COLLECTOR_AVOIDER_H__
 
 #include <ECS/ECS.h>
-#include "GameEvents.h"
-#include "WorldSystem.h"
-
+#include "GameTypes.h"
 
+#include <vector>
 
 class Collector;
 
-class CollectorAvoider : public ECS::Component<CollectorAvoider>, public ECS::Event::IEventListener
+// box in front of a collector in which other collectors are avoided, the detected collectors are updated by the PerceptionSystem
+class CollectorAvoider : public ECS::Component<CollectorAvoider>
 {
-	using DetectedCollector = std::list<const Collector*>;
-
-private:
+	friend class PerceptionSystem;
 
-	void RegisterEventCallbacks();
+	using DetectedCollector = std::vector<const Collector*>;
 
-	void OnCollisionBegin(const CollisionBeginEvent* event);
-	void OnCollisionEnd(const CollisionEndEvent* event);
+private:
 
 	DetectedCollector	m_DetectedCollector;
 
 	float			m_ViewDistance;
 	float			m_Width;
 
-	b2PolygonShape	m_b2AvoiderShape;
-	b2Fixture*		m_Avoider;
-
 public:
 
 	CollectorAvoider(float viewDistance, float width);
 	~CollectorAvoider();
 
-	void Initialize();
-	void Destroy();
-
-
 	inline const DetectedCollector& GetDetectedCollector() const { return this->m_DetectedCollector; }
 
 	inline const float GetViewDistance() const { return this->m_ViewDistance; }
@@ -0,0 +1,156 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	CollectorSteering.cpp.
+///
+/// Summary:	Implements the collector steering class.
+///-------------------------------------------------------------------------------------------------
+
+#include "CollectorSteering.h"
+#include "Collector.h"
+#include "Profiler.h"
+
+///-------------------------------------------------------------------------------------------------
+/// Summary:	Per behavior coefficients of the steering equations. With dot being the cosine between
+/// the collector's heading and the steering direction (target - position for relative behaviors):
+///
+/// 			angular velocity	= turnSpeed * (turnBase + turnDot * dot)
+/// 			speed				= COLLECTOR_MAX_MOVE_SPEED * (speedBase + speedDot * dot + speedAbsDot * |dot|)
+///
+/// This way all agents are steered by the same branch-free loop, whatever their behavior is.
+///-------------------------------------------------------------------------------------------------
+
+struct SteeringBehaviorCoefficients
+{
+	float m_Relative;
+	float m_TurnBase;
+	float m_TurnDot;
+	float m_SpeedBase;
+	float m_SpeedDot;
+	float m_SpeedAbsDot;
+};
+
+static constexpr SteeringBehaviorCoefficients STEERING_BEHAVIOR_COEFFICIENTS[MAX_STEERING_BEHAVIORS]
+{
+	/* STEER_STOP			*/ { 0.0f,  0.0f,  0.0f, 0.0f, 0.0f,  0.0f },
+	/* STEER_SEEK			*/ { 1.0f,  0.0f, -1.0f, 1.0f, 0.0f, -1.0f },
+	/* STEER_AVOID			*/ { 0.0f,  0.0f, -1.0f, 0.0f, 1.0f,  0.0f },
+	/* STEER_WANDER_LEFT	*/ { 0.0f,  1.0f,  0.0f, 1.0f, 0.0f,  0.0f },
+	/* STEER_WANDER_RIGHT	*/ { 0.0f, -1.0f,  0.0f, 1.0f, 0.0f,  0.0f }
+};
+
+CollectorSteering::CollectorSteering()
+{}
+
+CollectorSteering::~CollectorSteering()
+{}
+
+void CollectorSteering::AddAgent(const Collector* collector, const SteeringRequest& request)
+{
+	const Transform2D* T = collector->GetTransform()->AsTransform2D();
+	const SteeringBehaviorCoefficients& C = STEERING_BEHAVIOR_COEFFICIENTS[request.m_Behavior];
+
+	const glm::vec2 right = T->GetRight();
+	const glm::vec2 up = T->GetUp();
+
+	this->m_PositionX.push_back(T->GetPosition().x);
+	this->m_PositionY.push_back(T->GetPosition().y);
+	this->m_HeadingX.push_back(right.x);
+	this->m_HeadingY.push_back(right.y);
+	this->m_UpX.push_back(up.x);
+	this->m_UpY.push_back(up.y);
+
+	this->m_DirectionX.push_back(request.m_Direction.x);
+	this->m_DirectionY.push_back(request.m_Direction.y);
+	this->m_TurnSpeed.push_back(request.m_TurnSpeed);
+
+	this->m_Relative.push_back(C.m_Relative);
+	this->m_TurnBase.push_back(C.m_TurnBase);
+	this->m_TurnDot.push_back(C.m_TurnDot);
+	this->m_SpeedBase.push_back(C.m_SpeedBase);
+	this->m_SpeedDot.push_back(C.m_SpeedDot);
+	this->m_SpeedAbsDot.push_back(C.m_SpeedAbsDot);
+
+	this->m_Bodies.push_back(collector->GetRigidbody()->m_Box2DBody);
+}
+
+void CollectorSteering::Update()
+{
+	PROFILE_NESTED_SCOPE("CollectorSteering::Update");
+
+	const size_t N = this->m_Bodies.size();
+
+	this->m_LinearVelocityX.resize(N);
+	this->m_LinearVelocityY.resize(N);
+	this->m_AngularVelocity.resize(N);
+
+	// plain pointers, so the compiler does not have to assume the arrays alias
+	const float* const __restrict PX = this->m_PositionX.data();
+	const float* const __restrict PY = this->m_PositionY.data();
+	const float* const __restrict HX = this->m_HeadingX.data();
+	const float* const __restrict HY = this->m_HeadingY.data();
+	const float* const __restrict UX = this->m_UpX.data();
+	const float* const __restrict UY = this->m_UpY.data();
+	const float* const __restrict DX = this->m_DirectionX.data();
+	const float* const __restrict DY = this->m_DirectionY.data();
+	const float* const __restrict TS = this->m_TurnSpeed.data();
+	const float* const __restrict REL = this->m_Relative.data();
+	const float* const __restrict TB = this->m_TurnBase.data();
+	const float* const __restrict TD = this->m_TurnDot.data();
+	const float* const __restrict SB = this->m_SpeedBase.data();
+	const float* const __restrict SD = this->m_SpeedDot.data();
+	const float* const __restrict SA = this->m_SpeedAbsDot.data();
+
+	float* const __restrict LVX = this->m_LinearVelocityX.data();
+	float* const __restrict LVY = this->m_LinearVelocityY.data();
+	float* const __restrict AV = this->m_AngularVelocity.data();
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		// steering direction, relative to the collector for seek
+		const float dx = DX[i] - REL[i] * PX[i];
+		const float dy = DY[i] - REL[i] * PY[i];
+
+		// cosine between heading and direction, 0 if the direction is zero
+		const float lengthSq = (dx * dx + dy * dy) * (HX[i] * HX[i] + HY[i] * HY[i]);
+		const float dot = (dx * HX[i] + dy * HY[i]) / sqrtf(lengthSq > 0.0f ? lengthSq : 1.0f);
+
+		AV[i] = TS[i] * (TB[i] + TD[i] * dot);
+
+		const float speed = COLLECTOR_MAX_MOVE_SPEED * (SB[i] + SD[i] * dot + SA[i] * fabsf(dot));
+
+		LVX[i] = UX[i] * speed;
+		LVY[i] = UY[i] * speed;
+	}
+
+	// scatter results to the bodies
+	for (size_t i = 0; i < N; ++i)
+	{
+		this->m_Bodies[i]->SetLinearVelocity(b2Vec2(LVX[i], LVY[i]));
+		this->m_Bodies[i]->SetAngularVelocity(AV[i]);
+	}
+
+	Clear();
+}
+
+void CollectorSteering::Clear()
+{
+	// note: arrays are cleared, not freed, so they keep their capacity
+	this->m_PositionX.clear();
+	this->m_PositionY.clear();
+	this->m_HeadingX.clear();
+	this->m_HeadingY.clear();
+	this->m_UpX.clear();
+	this->m_UpY.clear();
+
+	this->m_DirectionX.clear();
+	this->m_DirectionY.clear();
+	this->m_TurnSpeed.clear();
+
+	this->m_Relative.clear();
+	this->m_TurnBase.clear();
+	this->m_TurnDot.clear();
+	this->m_SpeedBase.clear();
+	this->m_SpeedDot.clear();
+	this->m_SpeedAbsDot.clear();
+
+	this->m_Bodies.clear();
+}
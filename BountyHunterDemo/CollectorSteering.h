@@ -0,0 +1,141 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	CollectorSteering.h.
+///
+/// Summary:	Declares the collector steering class. The ai controllers only decide how their
+/// collector should steer (seek a target, avoid a threat, wander, stop). The steering of all
+/// collectors is then computed in one batch over structure of arrays and written to the collectors'
+/// bodies as linear and angular velocity.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __COLLECTOR_STEERING_H__
+#define __COLLECTOR_STEERING_H__
+
+#include <vector>
+
+#include "math.h"
+
+class Collector;
+class b2Body;
+
+enum SteeringBehavior
+{
+	// stop moving and turning
+	STEER_STOP = 0,
+
+	// turn towards a target position and move, slows down while turning
+	STEER_SEEK,
+
+	// turn towards a heading and move, moves backwards if facing away from the heading
+	STEER_AVOID,
+
+	// move full speed ahead while turning left or right
+	STEER_WANDER_LEFT,
+	STEER_WANDER_RIGHT,
+
+	MAX_STEERING_BEHAVIORS
+}; // enum SteeringBehavior
+
+///-------------------------------------------------------------------------------------------------
+/// Struct:	SteeringRequest
+///
+/// Summary:	How a collector should steer this tick.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+struct SteeringRequest
+{
+	SteeringBehavior	m_Behavior;
+
+	// target position (STEER_SEEK) or heading (STEER_AVOID), unused otherwise
+	glm::vec2			m_Direction;
+
+	// max. angular velocity
+	float				m_TurnSpeed;
+
+	SteeringRequest(SteeringBehavior behavior = STEER_STOP, const glm::vec2& direction = glm::vec2(0.0f), float turnSpeed = 0.0f) :
+		m_Behavior(behavior),
+		m_Direction(direction),
+		m_TurnSpeed(turnSpeed)
+	{}
+
+}; // struct SteeringRequest
+
+class CollectorSteering
+{
+	using FloatArray	= std::vector<float>;
+	using BodyArray		= std::vector<b2Body*>;
+
+private:
+
+	// gathered agent state
+	FloatArray		m_PositionX;
+	FloatArray		m_PositionY;
+	FloatArray		m_HeadingX;
+	FloatArray		m_HeadingY;
+	FloatArray		m_UpX;
+	FloatArray		m_UpY;
+
+	FloatArray		m_DirectionX;
+	FloatArray		m_DirectionY;
+	FloatArray		m_TurnSpeed;
+
+	// behavior coefficients, see STEERING_BEHAVIOR_COEFFICIENTS
+	FloatArray		m_Relative;
+	FloatArray		m_TurnBase;
+	FloatArray		m_TurnDot;
+	FloatArray		m_SpeedBase;
+	FloatArray		m_SpeedDot;
+	FloatArray		m_SpeedAbsDot;
+
+	// result
+	FloatArray		m_LinearVelocityX;
+	FloatArray		m_LinearVelocityY;
+	FloatArray		m_AngularVelocity;
+
+	BodyArray		m_Bodies;
+
+public:
+
+	CollectorSteering();
+	~CollectorSteering();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void CollectorSteering::AddAgent(const Collector* collector, const SteeringRequest& request);
+	///
+	/// Summary:	Gathers the collector's position and heading and its steering request for the next
+	/// Update. A collector must be added at most once per Update.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// collector - 	The collector.
+	/// request - 		The steering request.
+	///-------------------------------------------------------------------------------------------------
+
+	void AddAgent(const Collector* collector, const SteeringRequest& request);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void CollectorSteering::Update();
+	///
+	/// Summary:	Computes the steering of all added agents, sets their bodies' linear and angular
+	/// velocity and removes all agents.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void Update();
+
+	void Clear();
+
+	inline size_t size() const { return this->m_Bodies.size(); }
+
+}; // class CollectorSteering
+
+#endif // __COLLECTOR_STEERING_H__
@@ -83,4 +83,36 @@ void Controller::Update(float dt)
 		return;
 
 	this->m_ControllerImpl->Update(dt); 
+}
+
+bool Controller::IsConcurrent() const
+{
+	if (this->m_ControllerImpl == nullptr)
+		return false;
+
+	return this->m_ControllerImpl->IsConcurrent();
+}
+
+void Controller::UpdateConcurrent(float dt, ControllerCommandBuffer& commands)
+{
+	if (this->m_ControllerImpl == nullptr)
+		return;
+
+	this->m_ControllerImpl->UpdateConcurrent(dt, commands);
+}
+
+void Controller::OnPossessedKilled()
+{
+	if (this->m_ControllerImpl == nullptr)
+		return;
+
+	this->m_ControllerImpl->OnPossessedKilled();
+}
+
+void Controller::OnPossessedSpawned()
+{
+	if (this->m_ControllerImpl == nullptr)
+		return;
+
+	this->m_ControllerImpl->OnPossessedSpawned();
 }
\ No newline at end of file
@@ -36,6 +36,14 @@ public:
 
 	void Update(float dt);
 
+	bool IsConcurrent() const;
+
+	void UpdateConcurrent(float dt, ControllerCommandBuffer& commands);
+
+	void OnPossessedKilled();
+
+	void OnPossessedSpawned();
+
 }; // class Controller
 
 #endif // __CONTROLLER_H__
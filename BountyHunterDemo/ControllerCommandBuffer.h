@@ -0,0 +1,65 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	ControllerCommandBuffer.h.
+///
+/// Summary:	Declares the controller command buffer class. Controllers, which are updated
+/// concurrently, do not move their pawns directly, but record what they intent to do in a command
+/// buffer. The ControllerSystem keeps one buffer per thread and applies all of them serially after
+/// all controllers were updated.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __CONTROLLER_COMMAND_BUFFER_H__
+#define __CONTROLLER_COMMAND_BUFFER_H__
+
+#include <vector>
+
+#include "IController.h"
+#include "CollectorSteering.h"
+
+class ControllerCommandBuffer
+{
+	using GizmoList = std::vector<IController*>;
+
+private:
+
+	// steering of collectors
+	CollectorSteering	m_Steering;
+
+	// controllers, which want to draw their debug gizmos
+	GizmoList			m_Gizmos;
+
+public:
+
+	inline void Steer(const Collector* collector, const SteeringRequest& request)
+	{
+		this->m_Steering.AddAgent(collector, request);
+	}
+
+	inline void DrawGizmos(IController* controller)
+	{
+		this->m_Gizmos.push_back(controller);
+	}
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void ControllerCommandBuffer::Apply()
+	///
+	/// Summary:	Executes all recorded commands and clears the buffer.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void Apply()
+	{
+		// steer all collectors at once
+		this->m_Steering.Update();
+
+		for (auto C : this->m_Gizmos)
+			C->DrawGizmos();
+
+		this->m_Gizmos.clear();
+	}
+
+}; // class ControllerCommandBuffer
+
+#endif // __CONTROLLER_COMMAND_BUFFER_H__
@@ -5,9 +5,33 @@
 ///-------------------------------------------------------------------------------------------------
 
 #include "ControllerSystem.h"
+#include "Profiler.h"
+
+#include "TransformComponent.h"
+#include "RigidbodyComponent.h"
+#include "BountyRadar.h"
+#include "CollectorAvoider.h"
+
+#ifndef HEADLESS_SIMULATION
+#include "RenderSystem.h" // debug drawing
+#endif
 
 ControllerSystem::ControllerSystem()
 {
+	// controllers steer their pawns, they may be updated concurrently with other systems
+	ReadsComponents<TransformComponent, BountyRadar, CollectorAvoider>();
+	WritesComponents<RigidbodyComponent>();
+
+#ifndef HEADLESS_SIMULATION
+	if (DEBUG_DRAWING_ENABLED == true)
+		WritesSystems<RenderSystem>();
+#endif
+
+	if (CONTROLLER_WORKER_THREADS > 0)
+		this->m_WorkerPool.reset(new WorkerPool(CONTROLLER_WORKER_THREADS));
+
+	this->m_CommandBuffers.resize(this->m_WorkerPool != nullptr ? this->m_WorkerPool->GetNumThreads() : 1);
+
 	RegisterEventCallbacks();
 }
 
@@ -18,10 +42,37 @@ ControllerSystem::~ControllerSystem()
 
 void ControllerSystem::Update(float dt)
 {
+	PROFILE_SCOPE("ControllerSystem::Update");
+
+	// note: controllers, which are not concurrent (e.g. player input), are updated right away
+	this->m_ConcurrentController.clear();
 	for (auto C : this->m_Controller)
 	{
-		C->Update(dt);
+		if (C->IsConcurrent() == true)
+			this->m_ConcurrentController.push_back(C);
+		else
+			C->Update(dt);
 	}
+
+	auto UpdateControllers = [&](size_t begin, size_t end, size_t thread)
+	{
+		for (size_t i = begin; i < end; ++i)
+			this->m_ConcurrentController[i]->UpdateConcurrent(dt, this->m_CommandBuffers[thread]);
+	};
+
+	// note: sampled here rather than within the controllers, which would take the profiler's lock on every worker thread
+	{
+		PROFILE_NESTED_SCOPE("ControllerSystem::UpdateControllers");
+
+		if (this->m_WorkerPool != nullptr)
+			this->m_WorkerPool->ParallelFor(this->m_ConcurrentController.size(), CONTROLLER_UPDATE_BATCH_SIZE, UpdateControllers);
+		else
+			UpdateControllers(0, this->m_ConcurrentController.size(), 0);
+	}
+
+	// apply recorded commands serially
+	for (auto& commands : this->m_CommandBuffers)
+		commands.Apply();
 }
 
 void ControllerSystem::RegisterController(Controller* controller)
@@ -34,12 +85,41 @@ void ControllerSystem::UnregisterController(Controller* controller)
 	this->m_Controller.remove(controller);
 }
 
+Controller* ControllerSystem::GetPossessingController(const GameObjectId gameObjectId) const
+{
+	for (auto C : this->m_Controller)
+	{
+		if (C->GetPossessed() == gameObjectId)
+			return C;
+	}
+
+	return nullptr;
+}
+
 void ControllerSystem::RegisterEventCallbacks()
 {
+	RegisterEventCallback(&ControllerSystem::OnGameObjectKilled);
+	RegisterEventCallback(&ControllerSystem::OnGameObjectSpawned);
 }
 
 void ControllerSystem::UnregisterEventCallbacks()
 {
+	UnregisterEventCallback(&ControllerSystem::OnGameObjectKilled);
+	UnregisterEventCallback(&ControllerSystem::OnGameObjectSpawned);
+}
+
+void ControllerSystem::OnGameObjectKilled(const GameObjectKilled* event)
+{
+	Controller* controller = GetPossessingController(event->m_EntityID);
+	if (controller != nullptr)
+		controller->OnPossessedKilled();
+}
+
+void ControllerSystem::OnGameObjectSpawned(const GameObjectSpawned* event)
+{
+	Controller* controller = GetPossessingController(event->m_EntityID);
+	if (controller != nullptr)
+		controller->OnPossessedSpawned();
 }
 
 
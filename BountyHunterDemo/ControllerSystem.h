@@ -10,18 +10,40 @@
 #include <ECS/ECS.h>
 
 #include "Controller.h"
+#include "ControllerCommandBuffer.h"
+#include "WorkerPool.h"
+
+#include <memory>
 
 class ControllerSystem : public ECS::System<ControllerSystem>, public ECS::Event::IEventListener
 {
 	using RegisteredController = std::list<Controller*>;
+	using ControllerList = std::vector<Controller*>;
+	using CommandBuffers = std::vector<ControllerCommandBuffer>;
 
 private:
 
 	void RegisterEventCallbacks();
 	void UnregisterEventCallbacks();
 
+	// forwards events about a game object to the controller possessing it only
+	void OnGameObjectKilled(const GameObjectKilled* event);
+	void OnGameObjectSpawned(const GameObjectSpawned* event);
+
+	// returns the controller possessing gameObjectId, nullptr if there is none
+	Controller* GetPossessingController(const GameObjectId gameObjectId) const;
+
 	RegisteredController m_Controller;
 
+	// controllers updated concurrently this tick
+	ControllerList		m_ConcurrentController;
+
+	// one command buffer per thread, applied after all controllers were updated
+	CommandBuffers		m_CommandBuffers;
+
+	// nullptr, if controllers are updated on the calling thread only
+	std::unique_ptr<WorkerPool> m_WorkerPool;
+
 public:
 
 	ControllerSystem();
@@ -30,7 +30,11 @@ void DefaultMaterial::Unuse() const
 bool DefaultMaterial::Initialize()
 {
 	this->m_ShaderProgram = new ShaderProgram(new VertexShader(VERTEXT_SHADER), new FragmentShader(FRAGMENT_SHADER));
-	return (this->m_ShaderProgram->failed() == false && this->m_ShaderProgram->IsLinked());
+	if (this->m_ShaderProgram->failed() == true || this->m_ShaderProgram->IsLinked() == false)
+		return false;
+
+	// view and projection are read from the shared per frame camera uniform buffer
+	return this->m_ShaderProgram->BindUniformBlock(SHADER_UNIFORM_BLOCK_CAMERA, CAMERA_UNIFORM_BLOCK_BINDING);
 }
 
 void DefaultMaterial::Release()
@@ -22,10 +22,11 @@ class DefaultMaterial : public IMaterial
 		SHADER_DEFINE_INPUT_TEXCOORD_VERTEX_ATTRIBUTE
 		SHADER_DEFINE_INPUT_COLOR_VERTEX_ATTRIBUTE
 
-		SHADER_DEFINE_UNIFORM(SHADER_UNIFORM_MODEL_TRANSFORM,		"mat4")
-		SHADER_DEFINE_UNIFORM(SHADER_UNIFORM_VIEW_TRANSFORM,		"mat4")
-		SHADER_DEFINE_UNIFORM(SHADER_UNIFORM_PROJECTION_TRANSFORM,	"mat4")
-		SHADER_DEFINE_UNIFORM(SHADER_UNIFORM_COLOR0,				SHADER_UNIFORM_COLOR0_TYPE)
+		// model transform and color are per instance attributes
+		SHADER_DEFINE_INPUT_INSTANCE_MODEL_TRANSFORM_ATTRIBUTE
+		SHADER_DEFINE_INPUT_INSTANCE_COLOR0_ATTRIBUTE
+
+		SHADER_DEFINE_CAMERA_UNIFORM_BLOCK
 
 		"out " SHADER_IN_VERTEX_ATTRIBUTE_NORMAL_TYPE		" varNormal;\n"
 		"out " SHADER_IN_VERTEX_ATTRIBUTE_TEXCOORD_TYPE		" varTexCoord;\n"
@@ -35,9 +36,9 @@ class DefaultMaterial : public IMaterial
 		"{\n"
 		"	varNormal	= " SHADER_IN_VERTEX_ATTRIBUTE_NORMAL_NAME ";\n"
 		"	varTexCoord	= " SHADER_IN_VERTEX_ATTRIBUTE_TEXCOORD_NAME ";\n"
-		"	varColor	= " SHADER_UNIFORM_COLOR0 ";\n"
+		"	varColor	= " SHADER_IN_INSTANCE_ATTRIBUTE_COLOR0_NAME ";\n"
 
-		"	gl_Position = (" SHADER_UNIFORM_PROJECTION_TRANSFORM " * " SHADER_UNIFORM_VIEW_TRANSFORM " * " SHADER_UNIFORM_MODEL_TRANSFORM ") * vec4(" SHADER_IN_VERTEX_ATTRIBUTE_POSITION_NAME ", 1.0);\n"
+		"	gl_Position = (" SHADER_UNIFORM_VIEW_PROJECTION_TRANSFORM " * " SHADER_IN_INSTANCE_ATTRIBUTE_MODEL_TRANSFORM_NAME ") * vec4(" SHADER_IN_VERTEX_ATTRIBUTE_POSITION_NAME ", 1.0);\n"
 		"}\n"
 	};
 
@@ -83,22 +84,9 @@ public:
 
 	virtual void Release() override;
 
+	// model transform is a per instance attribute
 	virtual void SetModelTransform(const float* model) override
-	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniformMatrix4fv((*this->m_ShaderProgram)(SHADER_UNIFORM_MODEL_TRANSFORM), 1, GL_FALSE, (const GLfloat*)model);
-		}
-	}
-
-	virtual void SetViewProjectionTransform(const float* view, const float* proj) override
-	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniformMatrix4fv((*this->m_ShaderProgram)(SHADER_UNIFORM_VIEW_TRANSFORM), 1, GL_FALSE, (const GLfloat*)view);
-			glUniformMatrix4fv((*this->m_ShaderProgram)(SHADER_UNIFORM_PROJECTION_TRANSFORM), 1, GL_FALSE, (const GLfloat*)proj);
-		}
-	}
+	{}
 
 	virtual const MaterialVertexAttributeLoc GetPositionVertexAttributeLocation() const override
 	{
@@ -120,21 +108,30 @@ public:
 		return COLOR_MATERIAL_VERTEX_ATTRIBUTE_LOC;
 	}
 
+	virtual const MaterialVertexAttributeLoc GetInstanceModelTransformVertexAttributeLocation() const override
+	{
+		return INSTANCE_MODEL_TRANSFORM_MATERIAL_VERTEX_ATTRIBUTE_LOC;
+	}
+
+	virtual const MaterialVertexAttributeLoc GetInstanceColorVertexAttributeLocation() const override
+	{
+		return INSTANCE_COLOR0_MATERIAL_VERTEX_ATTRIBUTE_LOC;
+	}
+
+
+	virtual const MaterialUniformLoc GetUniformLocation(const char* uniformName) const override
+	{
+		return this->m_ShaderProgram != nullptr ? (*this->m_ShaderProgram)(uniformName) : INVALID_MATERIAL_UNIFORM_LOC;
+	}
 
-	virtual void SetUniform4fv(const char* uniformName, const float* vec4) override
+	virtual void SetUniform4fv(MaterialUniformLoc uniform, const float* vec4) override
 	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniform4fv((*this->m_ShaderProgram)(uniformName), 1, (const GLfloat*)vec4);
-		}
+		glUniform4fv(uniform, 1, (const GLfloat*)vec4);
 	}
 
-	virtual void SetUniformMatrix4fv(const char* uniformName, const float* mat4) override
+	virtual void SetUniformMatrix4fv(MaterialUniformLoc uniform, const float* mat4) override
 	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniformMatrix4fv((*this->m_ShaderProgram)(uniformName), 1, GL_FALSE, (const GLfloat*)mat4);
-		}
+		glUniformMatrix4fv(uniform, 1, GL_FALSE, (const GLfloat*)mat4);
 	}
 
 }; // class DefaultMaterial
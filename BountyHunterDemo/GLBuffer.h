@@ -255,4 +255,168 @@ struct IndexBuffer
 	inline void Reset() { this->m_CurrentBufferIndex = 0; }
 };
 
+///-------------------------------------------------------------------------------------------------
+/// Struct:	InstanceBuffer
+///
+/// Summary:	Auxillary class for per instance attribute buffers. Unlike the VertexBuffer the whole
+/// buffer content is replaced each frame and the buffer grows, if the instance data does not fit.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+using InstanceBufferID = GLuint;
+
+struct InstanceBuffer
+{
+	InstanceBufferID	m_ID;
+
+	GLsizeiptr			m_BufferCapacity;
+
+	InstanceBuffer(const GLsizeiptr size) :
+		m_BufferCapacity(size)
+	{
+		glGenBuffers(1, &this->m_ID);
+		glBindBuffer(GL_ARRAY_BUFFER, this->m_ID);
+
+		glBufferData(GL_ARRAY_BUFFER, size, 0, GL_STREAM_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glGetLastError();
+	}
+
+	~InstanceBuffer()
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glDeleteBuffers(1, &this->m_ID);
+
+		glGetLastError();
+	}
+
+	inline void Bind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, this->m_ID);
+	}
+
+	inline void Unbind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	inline const InstanceBufferID GetID() const { return this->m_ID; }
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void BufferInstanceData(const void* data, GLsizeiptr size)
+	///
+	/// Summary:	Replaces the buffer content with new instance data. The old buffer storage is
+	/// orphaned, so the driver does not have to wait for draw calls still using it. Vertex array
+	/// attribute bindings stay valid, since the buffer object itself is not replaced.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// data - 	   	The instance data.
+	/// size - 	   	The size in bytes.
+	///-------------------------------------------------------------------------------------------------
+
+	void BufferInstanceData(const void* data, GLsizeiptr size)
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, this->m_ID);
+
+		while (size > this->m_BufferCapacity)
+			this->m_BufferCapacity *= 2;
+
+		glBufferData(GL_ARRAY_BUFFER, this->m_BufferCapacity, 0, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glGetLastError();
+	}
+};
+
+///-------------------------------------------------------------------------------------------------
+/// Struct:	UniformBuffer
+///
+/// Summary:	Auxillary class for uniform buffer objects. A uniform buffer is bound to a binding
+/// point and shared by all shader programs, whose uniform blocks are assigned to that binding point.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+using UniformBufferID = GLuint;
+
+struct UniformBuffer
+{
+	UniformBufferID		m_ID;
+
+	const GLsizeiptr	m_BufferCapacity;
+
+	UniformBuffer(const GLsizeiptr size) :
+		m_BufferCapacity(size)
+	{
+		glGenBuffers(1, &this->m_ID);
+		glBindBuffer(GL_UNIFORM_BUFFER, this->m_ID);
+
+		glBufferData(GL_UNIFORM_BUFFER, size, 0, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		glGetLastError();
+	}
+
+	~UniformBuffer()
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glDeleteBuffers(1, &this->m_ID);
+
+		glGetLastError();
+	}
+
+	inline void Bind() const
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, this->m_ID);
+	}
+
+	inline void Unbind() const
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	inline void BindBase(GLuint binding) const
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, binding, this->m_ID);
+	}
+
+	inline const UniformBufferID GetID() const { return this->m_ID; }
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void BufferUniformData(const void* data, GLsizeiptr size)
+	///
+	/// Summary:	Replaces the buffer content with new uniform data.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// data - 	   	The uniform data, layed out according to the std140 rules.
+	/// size - 	   	The size in bytes.
+	///-------------------------------------------------------------------------------------------------
+
+	void BufferUniformData(const void* data, GLsizeiptr size)
+	{
+		assert(size <= this->m_BufferCapacity && "UniformBuffer capacity exceeded.");
+
+		glBindBuffer(GL_UNIFORM_BUFFER, this->m_ID);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		glGetLastError();
+	}
+};
+
 #endif // __GL_BUFFERS_H__
\ No newline at end of file
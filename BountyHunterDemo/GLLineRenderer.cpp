@@ -70,7 +70,7 @@ void GLLineRenderer::AddLine(const glm::vec3& p0, const glm::vec3& p1, const Col
 	this->m_LineCount += 2;
 }
 
-void GLLineRenderer::Flush(const float* projection, bool draw)
+void GLLineRenderer::Flush(bool draw)
 {
 	if(draw == false)
 		this->m_LineCount = 0;
@@ -80,8 +80,7 @@ void GLLineRenderer::Flush(const float* projection, bool draw)
 
 	this->m_LineMaterial.Use();
 	{
-		this->m_LineMaterial.SetViewProjectionTransform(nullptr, projection);
-
+		// projection is taken from the camera uniform buffer bound by the render system
 		this->m_VAO->Bind();
 		{
 			this->m_PositionVBO->Bind();
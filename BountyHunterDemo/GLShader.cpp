@@ -6,6 +6,8 @@
 
 #include "GLShader.h"
 
+#include <stdio.h>
+
 Shader::Shader(const char* code, GLenum type ) : mType(type)
 {
 	compile(code);
@@ -195,7 +197,7 @@ GLint ShaderProgram::AddUniform(const char* uni)
 	GLint loc = glGetUniformLocation(this->mShaderProgramID, uni);
 	glGetLastError();
 
-	mShaderAttributes[uni] = loc;
+	mShaderUniforms[uni] = loc;
 
 	return loc;
 }
@@ -220,4 +222,19 @@ GLint ShaderProgram::operator()(const char* uniform)
 		return AddUniform(uniform);
 
 	return loc->second;
-}
\ No newline at end of file
+}
+
+bool ShaderProgram::BindUniformBlock(const char* block, GLuint binding)
+{
+	GLuint index = glGetUniformBlockIndex(this->mShaderProgramID, block);
+	if(index == GL_INVALID_INDEX)
+	{
+		fprintf(stderr, "Shader program has no uniform block '%s'.\n", block);
+		return false;
+	}
+
+	glUniformBlockBinding(this->mShaderProgramID, index, binding);
+	glGetLastError();
+
+	return true;
+}
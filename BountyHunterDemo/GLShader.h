@@ -13,6 +13,7 @@
 
 #include <unordered_map>
 #include <vector>
+#include <string>
 
 
 /** \class Shader
@@ -137,7 +138,8 @@ private:
 	*/
 	void log();
 
-	typedef std::unordered_map<const char*, GLint> tShaderVars;
+	// keyed by name, not by pointer, since the same name may come from different string literals
+	typedef std::unordered_map<std::string, GLint> tShaderVars;
 	
 	/** mShaderAttributes
 		A collection of all shader attribute variables used by shaders in this program.
@@ -209,12 +211,25 @@ public:
 
 	/** Overload function operator
 	
-		\brief Returns the location of a uniform variable.
+		\brief Returns the location of a uniform variable. This is a lookup by name, it
+		should be used to resolve uniform locations once, not per draw call.
 
 		@param uniform The name of the uniform.
 	*/
 	GLint operator()(const char* uniform );
 
+	/** BindUniformBlock
+
+		\brief Assigns a uniform block of this program to a uniform buffer binding point.
+
+		@param block The name of the uniform block.
+
+		@param binding The uniform buffer binding point.
+
+		@return Returns false, if the program has no such uniform block.
+	*/
+	bool BindUniformBlock(const char* block, GLuint binding);
+
 	////////////////////////////////////////////////////
 	// ACCESSORS
 	////////////////////////////////////////////////////
@@ -24,8 +24,18 @@ void Game::GS_GAMEOVER_ENTER()
 
 	ECS::ECS_Engine->SendEvent<GameoverEvent>();
 
+#ifdef HEADLESS_SIMULATION
+	SDL_Log("Match %zu/%zu finished (%.2f ticks/s)\n", this->m_PlayedMatches + 1, HEADLESS_MATCH_COUNT, this->m_TPS.GetFPS());
+
+	// nobody is going to pick a menu option, restart or quit depending on played matches
+	if (++this->m_PlayedMatches < HEADLESS_MATCH_COUNT)
+		ECS::ECS_Engine->SendEvent<RestartGameEvent>();
+	else
+		ECS::ECS_Engine->SendEvent<QuitGameEvent>();
+#else
 	// print menu options to console
 	MenuSystem::PrintMenuOptions();
+#endif
 }
 
 void Game::GS_GAMEOVER_LEAVE()
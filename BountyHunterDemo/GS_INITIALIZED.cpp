@@ -16,14 +16,18 @@ void Game::GS_INITIALIZED()
 		CheatSystem*		CHEATS = ECS::ECS_Engine->GetSystemManager()->AddSystem<CheatSystem>();
 		}
 
+#ifndef HEADLESS_SIMULATION
 		// InputSystem
 		InputSystem*		InS = ECS::ECS_Engine->GetSystemManager()->AddSystem<InputSystem>();
+#endif
 		
 		// MenuSystem
 		MenuSystem*			MeS = ECS::ECS_Engine->GetSystemManager()->AddSystem<MenuSystem>();
 
+#ifndef HEADLESS_SIMULATION
 		// RenderSystem
 		RenderSystem*		RdS = ECS::ECS_Engine->GetSystemManager()->AddSystem<RenderSystem>(this->m_Window);
+#endif
 
 		// ATTENTION: The order how the Physics and World System are added matters!
 		// PhysicsSystem
@@ -38,33 +42,64 @@ void Game::GS_INITIALIZED()
 		// LifetimeSystem
 		LifetimeSystem*		LS = ECS::ECS_Engine->GetSystemManager()->AddSystem<LifetimeSystem>();
 
+		// PerceptionSystem
+		PerceptionSystem*	PeS = ECS::ECS_Engine->GetSystemManager()->AddSystem<PerceptionSystem>();
+
+		// NavigationSystem
+		NavigationSystem*	NaS = ECS::ECS_Engine->GetSystemManager()->AddSystem<NavigationSystem>();
+
 		// ControllerSystem
 		ControllerSystem*	CoS = ECS::ECS_Engine->GetSystemManager()->AddSystem<ControllerSystem>();
 
 		// PlayerSystem
 		PlayerSystem*		PlS = ECS::ECS_Engine->GetSystemManager()->AddSystem<PlayerSystem>();
 
+#ifdef HEADLESS_SIMULATION
+		// Add system dependencies
+		PyS->AddDependencies(WoS);
+		PeS->AddDependencies(PyS);
+		NaS->AddDependencies(PyS);
+		CoS->AddDependencies(PeS, NaS);
+		LS->AddDependencies(ReS);
+#else
 		// Change InputSystem's priority to high
 		ECS::ECS_Engine->GetSystemManager()->SetSystemPriority<InputSystem>(ECS::HIGH_SYSTEM_PRIORITY);
 
 		// Add system dependencies
-		CoS->AddDependencies(InS);
+		CoS->AddDependencies(InS, PeS, NaS);
 		WoS->AddDependencies(InS);
 		PyS->AddDependencies(InS, WoS);
+		PeS->AddDependencies(PyS);
+		NaS->AddDependencies(PyS);
 		RdS->AddDependencies(PyS);
 		LS->AddDependencies(ReS);
+#endif
 		
 		ECS::ECS_Engine->GetSystemManager()->UpdateSystemWorkOrder();
 
+		// update independent systems concurrently
+		if (SYSTEM_WORKER_THREADS > 0)
+		{
+			this->m_SystemScheduler = new ECS::SystemScheduler(ECS::ECS_Engine->GetSystemManager(), SYSTEM_WORKER_THREADS);
+			SDL_Log("Parallel system update enabled with %zu worker threads.\n", SYSTEM_WORKER_THREADS);
+		}
+
 		// create two system work state masks: one when runnign, one when game is paused
 		
 		// ingame system work state
 		this->m_Ingame_SystemWSM = ECS::ECS_Engine->GetSystemManager()->GetSystemWorkState();
 
 		// not ingame system work state (gameover, paused, ...)
+#ifdef HEADLESS_SIMULATION
+		this->m_NotIngame_SystemWSM = ECS::ECS_Engine->GetSystemManager()->GenerateActiveSystemWorkState(MeS, PlS);
+#else
 		this->m_NotIngame_SystemWSM = ECS::ECS_Engine->GetSystemManager()->GenerateActiveSystemWorkState(MeS, PlS, RdS, InS);
+#endif
 	} 
 
+	// apply initial main loop mode
+	this->SetSimulationTicksPerFrame(DEFAULT_SIMULATION_TICKS_PER_FRAME);
+
 	// put game to GameState 'RESTARTED'
 	ChangeState(GameState::RESTARTED);
 }
@@ -89,6 +124,7 @@ void Game::GS_INITIALIZED_ENTER()
 void Game::GS_INITIALIZED_LEAVE()
 {
 	RegisterEventCallback(&Game::OnToggleFullscreen);
+	RegisterEventCallback(&Game::OnToggleSimulationSpeed);
 
 	// raise game initialized event
 	ECS::ECS_Engine->SendEvent<GameInitializedEvent>();
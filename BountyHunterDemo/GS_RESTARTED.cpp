@@ -19,6 +19,8 @@ void Game::GS_RESTARTED()
 
 	ECS::ECS_Engine->GetSystemManager()->GetSystem<RespawnSystem>()->Reset();
 	ECS::ECS_Engine->GetSystemManager()->GetSystem<LifetimeSystem>()->Reset();
+	ECS::ECS_Engine->GetSystemManager()->GetSystem<PerceptionSystem>()->Reset();
+	ECS::ECS_Engine->GetSystemManager()->GetSystem<NavigationSystem>()->Reset();
 
 	// reset game context
 	this->m_GameContext = GameContext();
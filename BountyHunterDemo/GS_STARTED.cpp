@@ -44,7 +44,7 @@ void Game::GS_STARTED()
 	// Create Player
 	//------------------------------------------
  
-	const float STEP = glm::two_pi<float>() / max(1.0f, (float)MAX_PLAYER);
+	const float STEP = glm::two_pi<float>() / glm::max(1.0f, (float)MAX_PLAYER);
 	const float R = (WORLD_BOUND_MAX[0] - WORLD_BOUND_MIN[0]) * 0.5f;
 
 	for (size_t i = 0; i < MAX_PLAYER; ++i)
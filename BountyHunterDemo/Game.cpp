@@ -12,7 +12,10 @@ Game::Game(const char* name) :
 	m_Fullscreen(false),
 	m_WindowPosX(-1), m_WindowPosY(-1),
 	m_WindowWidth(-1), m_WindowHeight(-1),
-	m_DeltaTime(0.0f)
+	m_DeltaTime(0.0f),
+	m_SimulationTicksPerFrame(DEFAULT_SIMULATION_TICKS_PER_FRAME),
+	m_PlayedMatches(0),
+	m_SystemScheduler(nullptr)
 {}
 
 Game::~Game()
@@ -27,6 +30,10 @@ void Game::InitializeECS()
 
 void Game::InitializeSDL()
 {
+#ifdef HEADLESS_SIMULATION
+	// Initialize SDL 2.0 core only; there is no window, renderer or input in a headless build
+	SDL_Init(0);
+#else
 	// Initialize SDL 2.0
 	SDL_Init(SDL_INIT_VIDEO);
 
@@ -41,6 +48,7 @@ void Game::InitializeSDL()
 	// Place and resize application window
 	SDL_GetWindowPosition(this->m_Window, &this->m_WindowPosX, &this->m_WindowPosY);
 	SDL_GetWindowSize(this->m_Window, &this->m_WindowWidth, &this->m_WindowHeight);
+#endif // HEADLESS_SIMULATION
 }
 
 
@@ -60,6 +68,24 @@ void Game::Terminate()
 	// Unregister
 	UnregisterAllEventCallbacks();
 
+	// Dump profiler statistics
+	if (PROFILER_ENABLED == true)
+	{
+		g_Profiler.SetCounter("ECS event memory high water mark [bytes]", ECS::Event::GetEventMemoryHighWaterMark());
+
+		g_Profiler.PrintStats();
+
+		if (PROFILER_CSV_FILE != nullptr)
+			g_Profiler.WriteCSV(PROFILER_CSV_FILE);
+
+		if (PROFILER_TRACE_FILE != nullptr)
+			g_Profiler.WriteChromeTrace(PROFILER_TRACE_FILE);
+	}
+
+	// Stop system worker threads
+	delete this->m_SystemScheduler;
+	this->m_SystemScheduler = nullptr;
+
 	// Terminate ECS
 	ECS::Terminate();
 
@@ -141,8 +167,45 @@ void Game::ToggleFullscreen() {
 	SDL_SetWindowFullscreen(m_Window, m_Fullscreen);
 }
 
+void Game::SetSimulationTicksPerFrame(size_t ticksPerFrame)
+{
+	this->m_SimulationTicksPerFrame = ticksPerFrame < MAX_SIMULATION_TICKS_PER_FRAME ? ticksPerFrame : MAX_SIMULATION_TICKS_PER_FRAME;
+
+#ifndef HEADLESS_SIMULATION
+	// only sync with monitor refresh rate, if each tick is rendered
+	RenderSystem* RdS = ECS::ECS_Engine->GetSystemManager()->GetSystem<RenderSystem>();
+	if (RdS != nullptr)
+		RdS->SetVSync(this->m_SimulationTicksPerFrame == 1);
+#endif
+
+	if (this->m_SimulationTicksPerFrame > 0)
+		SDL_Log("Simulation ticks per frame: %zu\n", this->m_SimulationTicksPerFrame);
+	else
+		SDL_Log("Simulation ticks per frame: rendering off\n");
+}
+
 void Game::Run()
 {
+#ifdef HEADLESS_SIMULATION
+	// There is no window in a headless simulation, run until Game changes to 'TERMINATED' game state
+	while (this->IsTerminated() == false)
+	{
+		// Update the ECS
+		g_Profiler.BeginTick();
+		if (this->m_SystemScheduler != nullptr)
+			this->m_SystemScheduler->Update(DELTA_TIME_STEP);
+		g_Profiler.BeginEngineUpdate();
+		ECS::ECS_Engine->Update(DELTA_TIME_STEP);
+		g_Profiler.EndTick();
+
+		// Update Game
+		this->UpdateStateMachine();
+
+		// Update TPS counter, every tick is a frame in a headless simulation
+		this->m_DeltaTime = this->m_TPS.Update();
+
+	}; // MAIN SIMULATION LOOP!
+#else
 	// Window will be nulled, when Game changes to 'TERMINATED' game state
 	while (this->m_Window != nullptr)
 	{
@@ -151,21 +214,48 @@ void Game::Run()
 		if (this->m_Window == nullptr)
 			return;
 
-		// Update the ECS
-		ECS::ECS_Engine->Update(DELTA_TIME_STEP);
-
-		// Update Game
-		this->UpdateStateMachine();
+		// Run simulation ticks of this frame, only the last one is rendered
+		const size_t TICKS = this->m_SimulationTicksPerFrame > 0 ? this->m_SimulationTicksPerFrame : UNRENDERED_SIMULATION_TICKS;
+		for (size_t tick = 0; tick < TICKS; ++tick)
+		{
+			const bool RENDER = (this->m_SimulationTicksPerFrame > 0) && (tick == TICKS - 1);
+
+			if (ECS::ECS_Engine->GetSystemManager()->GetSystem<RenderSystem>() != nullptr)
+			{
+				if (RENDER == true)
+					ECS::ECS_Engine->GetSystemManager()->EnableSystem<RenderSystem>();
+				else
+					ECS::ECS_Engine->GetSystemManager()->DisableSystem<RenderSystem>();
+			}
+
+			// Update the ECS
+			g_Profiler.BeginTick();
+			if (this->m_SystemScheduler != nullptr)
+				this->m_SystemScheduler->Update(DELTA_TIME_STEP);
+			g_Profiler.BeginEngineUpdate();
+			ECS::ECS_Engine->Update(DELTA_TIME_STEP);
+			g_Profiler.EndTick();
+
+			// Update Game
+			this->UpdateStateMachine();
+
+			// Update TPS counter
+			this->m_TPS.Update();
+
+			if (this->m_Window == nullptr)
+				return;
+		}
 
 		// Update FPS counter
 		this->m_DeltaTime = this->m_FPS.Update();
 
-		// <Game Name> - <GameState> (<fps>)
+		// <Game Name> - <GameState> (<fps>, <tps>)
 		char buffer[256] { 0 };
-		sprintf_s(buffer, "%s - %s (%.2f fps)", this->m_GameTitle, GameState2String[(size_t)this->GetActiveState()], this->m_FPS.GetFPS());
+		sprintf_s(buffer, "%s - %s (%.2f fps, %.2f tps)", this->m_GameTitle, GameState2String[(size_t)this->GetActiveState()], this->m_FPS.GetFPS(), this->m_TPS.GetFPS());
 		SDL_SetWindowTitle(this->m_Window, buffer);
 
 	}; // MAIN GAME LOOP!
+#endif // HEADLESS_SIMULATION
 
 	int i = 0;
 }
\ No newline at end of file
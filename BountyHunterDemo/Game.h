@@ -22,18 +22,23 @@
 
 // utility
 #include "FPS.h"
-#include "SimpleFSM.h"
+#include "Profiler.h"
+#include "StaticFSM.h"
 
 // game systems
+#ifndef HEADLESS_SIMULATION
 #include "InputSystem.h"
-#include "MenuSystem.h"
 #include "RenderSystem.h"
+#endif
+#include "MenuSystem.h"
 #include "WorldSystem.h"
 #include "PlayerSystem.h"
 #include "LifetimeSystem.h"
 #include "RespawnSystem.h"
 #include "ControllerSystem.h"
 #include "PhysicsSystem.h"
+#include "PerceptionSystem.h"
+#include "NavigationSystem.h"
 #include "CheatSystem.h"
 
 // game entities
@@ -51,7 +56,7 @@
 
 
 
-class Game : protected ECS::Event::IEventListener, public SimpleFSM {
+class Game : protected ECS::Event::IEventListener, public StaticFSM<Game, GameState, GameState::MAX_GAMESTATES, 2> {
 
 public:
 
@@ -97,37 +102,50 @@ public:
 	///-------------------------------------------------------------------------------------------------
 
 
+	// Define FSM State table
+	BEGIN_FSM_STATE_TABLE
+
+		FSM_STATE(GameState::INITIALIZED	, &Game::GS_INITIALIZED	, &Game::GS_INITIALIZED_ENTER	, &Game::GS_INITIALIZED_LEAVE)
+		FSM_STATE(GameState::RESTARTED		, &Game::GS_RESTARTED	, &Game::GS_RESTARTED_ENTER		, &Game::GS_RESTARTED_LEAVE)
+		FSM_STATE(GameState::STARTED		, &Game::GS_STARTED		, &Game::GS_STARTED_ENTER		, &Game::GS_STARTED_LEAVE)
+		FSM_STATE(GameState::RUNNING		, &Game::GS_RUNNING		, &Game::GS_RUNNING_ENTER		, &Game::GS_RUNNING_LEAVE)
+		FSM_STATE(GameState::PAUSED			, &Game::GS_PAUSED		, &Game::GS_PAUSED_ENTER		, &Game::GS_PAUSED_LEAVE)
+		FSM_STATE(GameState::GAMEOVER		, &Game::GS_GAMEOVER	, &Game::GS_GAMEOVER_ENTER		, &Game::GS_GAMEOVER_LEAVE)
+		FSM_STATE(GameState::TERMINATED		, &Game::GS_TERMINATED	, &Game::GS_TERMINATED_ENTER	, &Game::GS_TERMINATED_LEAVE)
+
+	END_FSM_STATE_TABLE
+
 	// Define FSM Transition table
-	BEGIN_TRANSITION_TABLE
+	BEGIN_FSM_TRANSITION_TABLE
 
 		// Initial State
-		TRANSITION_ENTRY(NULL_STATE				, Game::GS_INITIALIZED	, Game::GS_INITIALIZED_ENTER, NO_ONLEAVE_PROC			, GameState::INITIALIZED)
+		FSM_INITIAL_TRANSITION(GameState::INITIALIZED)
 
 		// Transitions to 'RESTARTED'
-		TRANSITION_ENTRY(Game::GS_INITIALIZED	, Game::GS_RESTARTED	, Game::GS_RESTARTED_ENTER	, Game::GS_INITIALIZED_LEAVE, GameState::RESTARTED)
-		TRANSITION_ENTRY(Game::GS_PAUSED		, Game::GS_RESTARTED	, Game::GS_RESTARTED_ENTER	, Game::GS_PAUSED_LEAVE		, GameState::RESTARTED)
-		TRANSITION_ENTRY(Game::GS_GAMEOVER		, Game::GS_RESTARTED	, Game::GS_RESTARTED_ENTER	, Game::GS_GAMEOVER_LEAVE	, GameState::RESTARTED)
+		FSM_TRANSITION(GameState::INITIALIZED	, GameState::RESTARTED)
+		FSM_TRANSITION(GameState::PAUSED		, GameState::RESTARTED)
+		FSM_TRANSITION(GameState::GAMEOVER		, GameState::RESTARTED)
 
 		// Transitions to 'STARTED'
-		TRANSITION_ENTRY(Game::GS_RESTARTED		, Game::GS_STARTED		, Game::GS_STARTED_ENTER	, Game::GS_RESTARTED_LEAVE	, GameState::STARTED)
-		TRANSITION_ENTRY(Game::GS_PAUSED		, Game::GS_STARTED		, Game::GS_STARTED_ENTER	, Game::GS_PAUSED_LEAVE		, GameState::STARTED)
+		FSM_TRANSITION(GameState::RESTARTED		, GameState::STARTED)
+		FSM_TRANSITION(GameState::PAUSED		, GameState::STARTED)
 
 		// Transitions to 'PAUSED'
-		TRANSITION_ENTRY(Game::GS_STARTED		, Game::GS_PAUSED		, Game::GS_PAUSED_ENTER		, Game::GS_STARTED_LEAVE	, GameState::PAUSED)
-		TRANSITION_ENTRY(Game::GS_RUNNING		, Game::GS_PAUSED		, Game::GS_PAUSED_ENTER		, Game::GS_RUNNING_LEAVE	, GameState::PAUSED)
+		FSM_TRANSITION(GameState::STARTED		, GameState::PAUSED)
+		FSM_TRANSITION(GameState::RUNNING		, GameState::PAUSED)
 
 		// Transitions to 'RUNNING'
-		TRANSITION_ENTRY(Game::GS_STARTED		, Game::GS_RUNNING		, Game::GS_RUNNING_ENTER	, Game::GS_STARTED_LEAVE	, GameState::RUNNING)
-		TRANSITION_ENTRY(Game::GS_PAUSED		, Game::GS_RUNNING		, Game::GS_RUNNING_ENTER	, Game::GS_PAUSED_LEAVE		, GameState::RUNNING)
+		FSM_TRANSITION(GameState::STARTED		, GameState::RUNNING)
+		FSM_TRANSITION(GameState::PAUSED		, GameState::RUNNING)
 
 		// Transitions to 'GAMEOVER'
-		TRANSITION_ENTRY(Game::GS_RUNNING		, Game::GS_GAMEOVER		, Game::GS_GAMEOVER_ENTER	, Game::GS_RUNNING_LEAVE	, GameState::GAMEOVER)
+		FSM_TRANSITION(GameState::RUNNING		, GameState::GAMEOVER)
 
 		// Transitions to 'TERMINATED'
-		TRANSITION_ENTRY(Game::GS_GAMEOVER		, Game::GS_TERMINATED	, Game::GS_TERMINATED_ENTER	, Game::GS_GAMEOVER_LEAVE	, GameState::TERMINATED)
-		TRANSITION_ENTRY(Game::GS_PAUSED		, Game::GS_TERMINATED	, Game::GS_TERMINATED_ENTER	, Game::GS_PAUSED_LEAVE		, GameState::TERMINATED)
+		FSM_TRANSITION(GameState::GAMEOVER		, GameState::TERMINATED)
+		FSM_TRANSITION(GameState::PAUSED		, GameState::TERMINATED)
 
-	END_TRANSITION_TABLE
+	END_FSM_TRANSITION_TABLE
 
 
 	// FSM State callback functions
@@ -176,6 +194,7 @@ public:
 	void OnRestartGame(const RestartGameEvent* event);
 	void OnQuitGame(const QuitGameEvent* event);
 	void OnToggleFullscreen(const ToggleFullscreenEvent* event);
+	void OnToggleSimulationSpeed(const ToggleSimulationSpeedEvent* event);
 
 	void OnCollisionBegin(const CollisionBeginEvent* event);
 
@@ -198,12 +217,23 @@ private:
 	FPS							m_FPS;
 	float						m_DeltaTime;
 
+	// measures simulation ticks per second, like 'm_FPS' does for rendered frames
+	FPS							m_TPS;
+
+	// simulation ticks per rendered frame, 0 if rendering is turned off
+	size_t						m_SimulationTicksPerFrame;
+
 	GameContext					m_GameContext;
 
+	size_t						m_PlayedMatches;
+
 
 	ECS::SystemWorkStateMask	m_Ingame_SystemWSM;
 	ECS::SystemWorkStateMask	m_NotIngame_SystemWSM;
 
+	// updates independent systems concurrently, nullptr if systems are updated serially by the ECS
+	ECS::SystemScheduler*		m_SystemScheduler;
+
 private:
 
 	void InitializeECS();
@@ -251,12 +281,30 @@ public:
 	*/
 	void ToggleFullscreen();
 
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void Game::SetSimulationTicksPerFrame(size_t ticksPerFrame);
+	///
+	/// Summary:	Sets the amount of simulation ticks that are run per rendered frame. Vsync is only
+	/// enabled for a single tick per frame, otherwise the main loop runs as fast as possible. 
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// ticksPerFrame - 	The simulation ticks per frame. If 0, rendering is turned off.
+	///-------------------------------------------------------------------------------------------------
+
+	void SetSimulationTicksPerFrame(size_t ticksPerFrame);
+
 
 
 	inline SDL_Window*	GetWindow()				const { return this->m_Window; }
 
 	inline bool			IsFullscreenMode()		const { return m_Fullscreen; }
 
+	inline size_t		GetSimulationTicksPerFrame() const { return this->m_SimulationTicksPerFrame; }
+
 	inline GameState	GetActiveGameState()	const { return (GameState)this->GetActiveState(); }
 	inline bool			IsInitialized()			const { return (this->GetActiveState() >  GameState::INITIALIZED); }
 	inline bool			IsRestarted()			const { return (this->GetActiveState() == GameState::RESTARTED); }
@@ -22,9 +22,9 @@ public:
 
 	virtual ECS::EntityId GetCameraID() const = 0;
 
-	virtual Transform GetProjectionTransform() = 0;
+	virtual const Transform& GetProjectionTransform() = 0;
 
-	virtual Transform GetViewTransform() = 0;
+	virtual const Transform& GetViewTransform() = 0;
 
 }; // IGameCamera
 
@@ -54,7 +54,7 @@ protected:
 public:
 
 	template<class... ARGS>
-	GameCamera(ARGS&... args) :
+	GameCamera(ARGS&&... args) :
 		m_Camera(new C(std::forward<ARGS>(args)...)),
 		m_viewDirty(true),
 		m_projectionDirty(true),
@@ -78,7 +78,7 @@ public:
 
 	virtual ECS::EntityId GetCameraID() const override { return this->m_EntityID; }
 
-	virtual Transform GetProjectionTransform() override
+	virtual const Transform& GetProjectionTransform() override
 	{
 		if (this->m_projectionDirty == true)
 		{
@@ -89,7 +89,7 @@ public:
 		return this->m_ProjectionTransform;
 	}
 
-	virtual Transform GetViewTransform() override
+	virtual const Transform& GetViewTransform() override
 	{
 		if (this->m_viewDirty == true)
 		{
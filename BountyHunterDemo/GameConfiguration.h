@@ -36,6 +36,17 @@ static constexpr bool				GAME_WINDOW_FULLSCREEN				{ false };
 /// Summary:	Defines the delta time step the game simulation will be advanced per update.
 static constexpr float				DELTA_TIME_STEP						{ 1.0f / 60.0f };
 
+/// Summary:	The default amount of simulation ticks per rendered frame. Only if set to 1 the game
+/// runs with vsync, any other value runs the main loop as fast as possible. 0 turns rendering off.
+static constexpr size_t				DEFAULT_SIMULATION_TICKS_PER_FRAME	{ 1 };
+
+/// Summary:	The max. amount of simulation ticks per rendered frame.
+static constexpr size_t				MAX_SIMULATION_TICKS_PER_FRAME		{ 64 };
+
+/// Summary:	Amount of simulation ticks per main loop iteration, if rendering is turned off.
+/// Window events are processed only once per main loop iteration.
+static constexpr size_t				UNRENDERED_SIMULATION_TICKS			{ 256 };
+
 /// Summary:	The world up vector.
 static constexpr float				WORLD_UP_VECTOR[2]					{ 0.0f, 1.0f };
 
@@ -111,6 +122,73 @@ static constexpr float				AI_VIEW_DISTANCE_BOUNTY				{ 25.0f }; // meter
 /// Summary:	Distance the ai can see obstacles/collector.
 static constexpr float				AI_VIEW_DISTANCE_OBSTACLE			{ AI_VIEW_DISTANCE_BOUNTY * 0.75f };
 
+/// Summary:	Cell size of the perception system's uniform grids. A radar query touches about
+/// (2 * AI_VIEW_DISTANCE_BOUNTY / PERCEPTION_GRID_CELL_SIZE + 1)^2 cells.
+static constexpr float				PERCEPTION_GRID_CELL_SIZE			{ 10.0f }; // meter
+
+/// Summary:	Cell size of the navigation system's flow fields, one field per stash over the world
+/// bounds.
+static constexpr float				NAVIGATION_GRID_CELL_SIZE			{ 2.5f }; // meter
+
+/// Summary:	Additional cost of crossing a navigation grid cell covered by another player's
+/// collector, 0 ignores collectors.
+static constexpr float				NAVIGATION_COLLECTOR_COST			{ 8.0f };
+
+/// Summary:	Max. number of flow fields the navigation system updates per tick, after collectors
+/// have moved to other cells. Remaining fields are updated in the following ticks.
+static constexpr size_t				NAVIGATION_FIELD_UPDATES_PER_TICK	{ 2 };
+
+// <<<< SYSTEM SETTINGS >>>>
+
+/// Summary:	Number of worker threads, which update independent systems concurrently with the main
+/// thread. Only systems which have declared their component access run concurrently, see
+/// ECS::System::ReadsComponents. 0 updates all systems serially on the main thread.
+static constexpr size_t				SYSTEM_WORKER_THREADS				{ 2 };
+
+/// Summary:	Number of worker threads, which update ai controllers concurrently with the thread
+/// running the ControllerSystem. 0 updates all controllers on that thread.
+static constexpr size_t				CONTROLLER_WORKER_THREADS			{ 3 };
+
+/// Summary:	Number of controllers a controller worker thread updates at once.
+static constexpr size_t				CONTROLLER_UPDATE_BATCH_SIZE		{ 4 };
+
+// <<<< HEADLESS SIMULATION SETTINGS >>>>
+
+///-------------------------------------------------------------------------------------------------
+/// Def:	HEADLESS_SIMULATION
+///
+/// Summary:	If defined, the game is build without window, renderer and input handling. The game
+/// simulation runs as fast as possible. This is set by the headless build target (CMakeLists.txt).
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+//#define HEADLESS_SIMULATION												1
+
+/// Summary:	Number of matches a headless simulation plays before it terminates.
+static constexpr size_t				HEADLESS_MATCH_COUNT				{ 1 };
+
+
+// <<<< PROFILER SETTINGS >>>>
+
+/// Summary:	True to enable the frame profiler.
+static constexpr bool				PROFILER_ENABLED					{ true };
+
+/// Summary:	Amount of most recent samples per probe the profiler statistics are computed from.
+static constexpr size_t				PROFILER_SAMPLE_WINDOW				{ 1024 };
+
+/// Summary:	File the profiler statistics are written to when the game ends, nullptr to disable.
+static constexpr const char*		PROFILER_CSV_FILE					{ nullptr };
+
+/// Summary:	File a chrome://tracing trace is written to when the game ends, nullptr to disable.
+static constexpr const char*		PROFILER_TRACE_FILE					{ nullptr };
+
+/// Summary:	The max. amount of recorded trace events, recording stops when reached.
+static constexpr size_t				PROFILER_MAX_TRACE_EVENTS			{ 1 << 20 };
+
+
 // <<<< DEBUG SETTINGS >>>>
 
 ///-------------------------------------------------------------------------------------------------
@@ -129,6 +207,10 @@ static constexpr float				AI_VIEW_DISTANCE_OBSTACLE			{ AI_VIEW_DISTANCE_BOUNTY
 static constexpr bool				ALLOW_CHEATS						{ true };
 
 /// Summary:	True to enable the debug drawing.
+#ifdef HEADLESS_SIMULATION
+static constexpr bool				DEBUG_DRAWING_ENABLED				{ false };
+#else
 static constexpr bool				DEBUG_DRAWING_ENABLED				{ true };
+#endif
 
 #endif // __GAME_CONFIG_H__
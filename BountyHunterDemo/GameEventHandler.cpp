@@ -34,6 +34,17 @@ void Game::OnToggleFullscreen(const ToggleFullscreenEvent* event)
 	this->ToggleFullscreen();
 }
 
+void Game::OnToggleSimulationSpeed(const ToggleSimulationSpeedEvent* event)
+{
+	// 1 -> 2 -> 4 -> ... -> MAX_SIMULATION_TICKS_PER_FRAME -> rendering off -> 1
+	if (this->m_SimulationTicksPerFrame == 0)
+		this->SetSimulationTicksPerFrame(1);
+	else if (this->m_SimulationTicksPerFrame >= MAX_SIMULATION_TICKS_PER_FRAME)
+		this->SetSimulationTicksPerFrame(0);
+	else
+		this->SetSimulationTicksPerFrame(this->m_SimulationTicksPerFrame * 2);
+}
+
 void Game::OnCollisionBegin(const CollisionBeginEvent* event)
 {
 	ECS::IEntity* objectA = ECS::ECS_Engine->GetEntityManager()->GetEntity(event->objectA);
@@ -77,10 +88,7 @@ void Game::OnCollisionBegin(const CollisionBeginEvent* event)
 
 		if ((typeA == Collector::STATIC_ENTITY_TYPE_ID) && (typeB == Bounty::STATIC_ENTITY_TYPE_ID))
 		{
-			// note: ai controlled collector entities use an additional collision shape (a sensor)
-			// to get notified when bounty is in range. This sensor-shape also will trigger this 
-			// collision check, so we need to check if the collision categories are not of type
-			// radar here...
+			// note: only the collector's body shape collects bounty.
 			if(event->details.collisionCategoryA == CollisionCategory::Player_Category)
 				CollectBountyAction((Collector*)objectA, (Bounty*)objectB);
 		}
@@ -120,13 +128,14 @@ void Game::OnCollisionBegin(const CollisionBeginEvent* event)
 	{
 		static const auto WallCollisionAction = [](Collector* collector, Wall* wall)
 		{
-			auto collTC = collector->GetComponent<TransformComponent>()->AsTransform();
-			auto wallTC = wall->GetComponent<TransformComponent>()->AsTransform();
+			auto collTFC = collector->GetComponent<TransformComponent>();
+			auto collTC = collTFC->AsTransform2D();
+			auto wallTC = wall->GetComponent<TransformComponent>()->AsTransform2D();
 
 			auto collPos = collTC->GetPosition();
 			auto wallNrm = wallTC->GetRight();
 			
-			auto newPos = Position(collPos);
+			auto newPos = Position2D(collPos);
 			
 			if ((glm::abs(wallNrm.x) > 0.005f) == true)
 			{
@@ -138,7 +147,7 @@ void Game::OnCollisionBegin(const CollisionBeginEvent* event)
 				newPos.y *= -0.95f;
 			}
 
-			collTC->SetPosition(newPos);
+			collTFC->SetPosition(newPos);
 			collector->GetComponent<RigidbodyComponent>()->SetTransform(*collTC);			
 		};
 
@@ -11,7 +11,7 @@
 
 #include "GameTypes.h"
 
-#include "Transform.h"
+#include "Transform2D.h"
 
 ///-------------------------------------------------------------------------------------------------
 /// Summary:	General game state events.
@@ -191,9 +191,9 @@ struct GameObjectDestroyed : public ECS::Event::Event<GameObjectDestroyed>
 struct GameObjectSpawned : public ECS::Event::Event<GameObjectSpawned>
 {
 	GameObjectId	m_EntityID;
-	Transform		m_Transform;
+	Transform2D		m_Transform;
 
-	GameObjectSpawned(GameObjectId id, const Transform& transform) :
+	GameObjectSpawned(GameObjectId id, const Transform2D& transform) :
 		m_EntityID(id),
 		m_Transform(transform)
 	{}
@@ -345,4 +345,7 @@ struct CollisionEndEvent : public ECS::Event::Event<CollisionEndEvent>
 struct ToggleDebugDrawEvent : public ECS::Event::Event<ToggleDebugDrawEvent>
 {};
 
+struct ToggleSimulationSpeedEvent : public ECS::Event::Event<ToggleSimulationSpeedEvent>
+{};
+
 #endif // __GAME_EVENTS_H__
\ No newline at end of file
@@ -23,7 +23,7 @@ public:
 
 	GameObject()
 	{
-		AddComponent<TransformComponent>(Transform());
+		this->template AddComponent<TransformComponent>(Transform());
 		ECS::ECS_Engine->SendEvent<GameObjectCreated>(this->GetEntityID(), this->GetStaticEntityTypeID());
 	}
 
@@ -0,0 +1,64 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	GameObjectTracker.h.
+///
+/// Summary:	Declares the game object tracker class. Systems, which work on all game objects of
+/// a type, keep them in a tracker filled from the GameObjectCreated and GameObjectDestroyed events.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __GAME_OBJECT_TRACKER_H__
+#define __GAME_OBJECT_TRACKER_H__
+
+#include <ECS/ECS.h>
+
+#include <vector>
+
+#include "GameTypes.h"
+
+class GameObjectTracker
+{
+public:
+
+	struct TrackedGameObject
+	{
+		// note: the id is kept, since the entity may already be gone, when its destroyed event arrives
+		GameObjectId		m_GameObjectId;
+		ECS::IEntity*		m_GameObject;
+	};
+
+	using TrackedGameObjects = std::vector<TrackedGameObject>;
+
+private:
+
+	TrackedGameObjects	m_GameObjects;
+
+public:
+
+	void Add(GameObjectId gameObjectId)
+	{
+		ECS::IEntity* entity = ECS::ECS_Engine->GetEntityManager()->GetEntity(gameObjectId);
+		assert(entity != nullptr && "Failed to retrieve entity by id!");
+
+		this->m_GameObjects.push_back({ gameObjectId, entity });
+	}
+
+	void Remove(GameObjectId gameObjectId)
+	{
+		for (size_t i = 0; i < this->m_GameObjects.size(); ++i)
+		{
+			if (this->m_GameObjects[i].m_GameObjectId == gameObjectId)
+			{
+				this->m_GameObjects[i] = this->m_GameObjects.back();
+				this->m_GameObjects.pop_back();
+				return;
+			}
+		}
+	}
+
+	inline void Clear() { this->m_GameObjects.clear(); }
+
+	inline TrackedGameObjects::const_iterator begin() const { return this->m_GameObjects.begin(); }
+	inline TrackedGameObjects::const_iterator end() const { return this->m_GameObjects.end(); }
+
+}; // class GameObjectTracker
+
+#endif // __GAME_OBJECT_TRACKER_H__
@@ -60,9 +60,7 @@ enum CollisionCategory
 	Player_Category					= 0x0002,
 	Bounty_Category					= 0x0004,
 	Stash_Category					= 0x0008,
-	Wall_Category					= 0x0010,
-	BountyRadar_Category			= 0x0020,
-	ObstacleAvoider_Category		= 0x0040
+	Wall_Category					= 0x0010
 
 }; // enum CollistionCategory
 
@@ -72,9 +70,7 @@ enum CollisionMask
 	Player_Collision				= CollisionMask::Default_Collision,
 	Bounty_Collision				= (CollisionMask::Default_Collision ^ (CollisionCategory::Bounty_Category | CollisionCategory::Stash_Category | CollisionCategory::Wall_Category)),
 	Stash_Collision					= CollisionMask::Default_Collision,
-	Wall_Collision					= (CollisionMask::Default_Collision ^ (CollisionCategory::Wall_Category)),
-	BountyRadar_Collision			= CollisionCategory::Bounty_Category,
-	ObstacleAvoide_Collisionr		= CollisionCategory::Player_Category
+	Wall_Collision					= (CollisionMask::Default_Collision ^ (CollisionCategory::Wall_Category))
 	
 }; // enum CollisionMask
 
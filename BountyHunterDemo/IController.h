@@ -16,6 +16,8 @@
 
 #include "GameObject.h"
 
+class ControllerCommandBuffer;
+
 ///-------------------------------------------------------------------------------------------------
 /// Class:	IController
 ///
@@ -46,6 +48,41 @@ public:
 
 	virtual void Update(float dt) = 0;
 
+	// true, if the controller can be updated concurrently with other controllers (UpdateConcurrent)
+	virtual bool IsConcurrent() const { return false; }
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	virtual void IController::UpdateConcurrent(float dt, ControllerCommandBuffer& commands)
+	///
+	/// Summary:	Updates the controller on a worker thread, if IsConcurrent. The game world does not
+	/// change while controllers are updated, so the controller may read it, but it must only change its
+	/// own state. Anything else, like moving its pawn, has to be recorded in commands, which are applied
+	/// serially after all controllers were updated.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// dt - 		The dt.
+	/// commands - 	The command buffer of the updating thread.
+	///-------------------------------------------------------------------------------------------------
+
+	virtual void UpdateConcurrent(float, ControllerCommandBuffer&)
+	{}
+
+	// called by the ControllerSystem, when the possessed game object was killed
+	virtual void OnPossessedKilled()
+	{}
+
+	// called by the ControllerSystem, when the possessed game object was (re)spawned
+	virtual void OnPossessedSpawned()
+	{}
+
+	// draws debug gizmos, never called concurrently
+	virtual void DrawGizmos()
+	{}
+
 }; // class IController
 
 #endif // __I_CONTROLLER_H__
@@ -18,6 +18,8 @@
 
 #define SHADER_DEFINE_SAMPLER2D(name)								SHADER_DEFINE_UNIFORM(name, "sampler2D")
 
+#define SHADER_DEFINE_UNIFORM_BLOCK(name, members)					"layout(std140) uniform " name "\n{\n" members "};\n"
+
 
 // DEFAULT INPUT VERTEX ATTRIBUTES	
 #define	SHADER_IN_VERTEX_ATTRIBUTE_POSITION_NAME					"vPosition"
@@ -39,6 +41,18 @@
 #define SHADER_DEFINE_INPUT_COLOR_VERTEX_ATTRIBUTE					SHADER_DEFINE_INPUT_VERTEX_ATTRIBUTE(SHADER_IN_VERTEX_ATTRIBUTE_COLOR_NAME,		SHADER_IN_VERTEX_ATTRIBUTE_COLOR_TYPE,		3)
 
 
+// INSTANCED INPUT VERTEX ATTRIBUTES (advanced once per instance)
+#define SHADER_IN_INSTANCE_ATTRIBUTE_MODEL_TRANSFORM_NAME			"iModelTransform"
+#define SHADER_IN_INSTANCE_ATTRIBUTE_MODEL_TRANSFORM_TYPE			"mat4"
+
+#define SHADER_IN_INSTANCE_ATTRIBUTE_COLOR0_NAME					"iColor0"
+#define SHADER_IN_INSTANCE_ATTRIBUTE_COLOR0_TYPE					"vec4"
+
+// note: a mat4 attribute occupies 4 consecutive locations (4 - 7)
+#define SHADER_DEFINE_INPUT_INSTANCE_MODEL_TRANSFORM_ATTRIBUTE		SHADER_DEFINE_INPUT_VERTEX_ATTRIBUTE(SHADER_IN_INSTANCE_ATTRIBUTE_MODEL_TRANSFORM_NAME,	SHADER_IN_INSTANCE_ATTRIBUTE_MODEL_TRANSFORM_TYPE,	4)
+#define SHADER_DEFINE_INPUT_INSTANCE_COLOR0_ATTRIBUTE				SHADER_DEFINE_INPUT_VERTEX_ATTRIBUTE(SHADER_IN_INSTANCE_ATTRIBUTE_COLOR0_NAME,			SHADER_IN_INSTANCE_ATTRIBUTE_COLOR0_TYPE,			8)
+
+
 
 // DEFAULT OUTPUT VERTEX ATTRIBUTES	
 #define SHADER_OUT_VERTEX_ATTRIBUTE_COLOR_NAME						"vColor"
@@ -57,21 +71,41 @@
 
 #define SHADER_UNIFORM_COLOR0_TYPE									"vec4"
 
+
+// PER FRAME CAMERA UNIFORM BLOCK (shared by all materials, updated once per frame by the render system)
+#define SHADER_UNIFORM_BLOCK_CAMERA									"CameraData"
+
+#define SHADER_UNIFORM_VIEW_PROJECTION_TRANSFORM					"uViewProjectionTransform"
+
+// note: member layout must match RenderSystem::CameraData
+#define SHADER_DEFINE_CAMERA_UNIFORM_BLOCK							SHADER_DEFINE_UNIFORM_BLOCK(SHADER_UNIFORM_BLOCK_CAMERA, \
+																		"	mat4 " SHADER_UNIFORM_VIEW_TRANSFORM ";\n" \
+																		"	mat4 " SHADER_UNIFORM_PROJECTION_TRANSFORM ";\n" \
+																		"	mat4 " SHADER_UNIFORM_VIEW_PROJECTION_TRANSFORM ";\n")
+
 #include <stdint.h>
 
 #include "math.h"
 
 typedef uint16_t MaterialID;
 typedef uint32_t MaterialVertexAttributeLoc;
+typedef int32_t  MaterialUniformLoc;
 
 static constexpr MaterialID					INVALID_MATERIAL_ID						{ 0xffff };
 static constexpr MaterialVertexAttributeLoc	INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC	{ 0xffffffff };
+static constexpr MaterialUniformLoc			INVALID_MATERIAL_UNIFORM_LOC			{ -1 };
 
 static constexpr MaterialVertexAttributeLoc POSITION_MATERIAL_VERTEX_ATTRIBUTE_LOC	{ 0 };
 static constexpr MaterialVertexAttributeLoc NORMAL_MATERIAL_VERTEX_ATTRIBUTE_LOC	{ 1 };
 static constexpr MaterialVertexAttributeLoc TEXCOORD_MATERIAL_VERTEX_ATTRIBUTE_LOC	{ 2 };
 static constexpr MaterialVertexAttributeLoc COLOR_MATERIAL_VERTEX_ATTRIBUTE_LOC		{ 3 };
 
+static constexpr MaterialVertexAttributeLoc INSTANCE_MODEL_TRANSFORM_MATERIAL_VERTEX_ATTRIBUTE_LOC	{ 4 };
+static constexpr MaterialVertexAttributeLoc INSTANCE_COLOR0_MATERIAL_VERTEX_ATTRIBUTE_LOC			{ 8 };
+
+// uniform buffer binding point of the per frame camera uniform block
+static constexpr uint32_t					CAMERA_UNIFORM_BLOCK_BINDING			{ 0 };
+
 
 class IMaterial
 {
@@ -117,34 +151,56 @@ public:
 
 	virtual void SetModelTransform(const float* model) = 0;
 
+	virtual const MaterialVertexAttributeLoc GetPositionVertexAttributeLocation() const = 0;
+
+	virtual const MaterialVertexAttributeLoc GetNormalVertexAttributeLocation() const = 0;
+
+	virtual const MaterialVertexAttributeLoc GetTexCoordVertexAttributeLocation() const = 0;
+
+	virtual const MaterialVertexAttributeLoc GetColorVertexAttributeLocation() const = 0;
+
 	///-------------------------------------------------------------------------------------------------
 	/// Fn:
-	/// virtual void IMaterial::SetViewPerspectiveTransform(const float* view, const float* pers) = 0;
+	/// virtual const MaterialVertexAttributeLoc IMaterial::GetInstanceModelTransformVertexAttributeLocation() const
 	///
-	/// Summary:	If the material uses shader with view and/or perspective transformation they can by applied here.
+	/// Summary:	Gets the location of the per instance model transform attribute. Materials that
+	/// provide a per instance model transform and color attribute are rendered instanced.
 	///
 	/// Author:	Tobias Stein
 	///
-	/// Date:	8/10/2017
+	/// Date:	17/10/2026
 	///
-	/// Parameters:
-	/// view - 	   	The view.
-	/// pers - 	   	The proj.
+	/// Returns:	The attribute location or INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC, if the material
+	/// does not support instancing.
 	///-------------------------------------------------------------------------------------------------
 
-	virtual void SetViewProjectionTransform(const float* view, const float* proj) = 0;
+	virtual const MaterialVertexAttributeLoc GetInstanceModelTransformVertexAttributeLocation() const { return INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC; }
 
-	virtual const MaterialVertexAttributeLoc GetPositionVertexAttributeLocation() const = 0;
+	virtual const MaterialVertexAttributeLoc GetInstanceColorVertexAttributeLocation() const { return INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC; }
 
-	virtual const MaterialVertexAttributeLoc GetNormalVertexAttributeLocation() const = 0;
 
-	virtual const MaterialVertexAttributeLoc GetTexCoordVertexAttributeLocation() const = 0;
-
-	virtual const MaterialVertexAttributeLoc GetColorVertexAttributeLocation() const = 0;
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:
+	/// virtual const MaterialUniformLoc IMaterial::GetUniformLocation(const char* uniformName) const = 0;
+	///
+	/// Summary:	Resolves the location of a uniform by its name. Name lookups are slow, resolve the
+	/// location once and set the uniform by its location.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// uniformName - 	Name of the uniform.
+	///
+	/// Returns:	The uniform location or INVALID_MATERIAL_UNIFORM_LOC, if the material's shader has
+	/// no such uniform.
+	///-------------------------------------------------------------------------------------------------
 
+	virtual const MaterialUniformLoc GetUniformLocation(const char* uniformName) const = 0;
 
-	virtual void SetUniform4fv(const char* uniformName, const float* vec4) = 0;
-	virtual void SetUniformMatrix4fv(const char* uniformName, const float* mat4) = 0;
+	virtual void SetUniform4fv(MaterialUniformLoc uniform, const float* vec4) = 0;
+	virtual void SetUniformMatrix4fv(MaterialUniformLoc uniform, const float* mat4) = 0;
 };
 
 #endif // __I_MATERIAL_H__
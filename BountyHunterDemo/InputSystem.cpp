@@ -5,9 +5,11 @@
 ///-------------------------------------------------------------------------------------------------
 
 #include "InputSystem.h"
+#include "Profiler.h"
 #include "GameEvents.h"
 
 #include <SDL.h>
+#include <string.h>
 
 InputSystem::InputSystem()
 {
@@ -25,6 +27,8 @@ InputSystem::~InputSystem()
 
 void InputSystem::PreUpdate(float dt)
 {
+	PROFILE_SCOPE("InputSystem::PreUpdate");
+
 	SDL_Event event;
 
 	// only handle keyboard and mouse events
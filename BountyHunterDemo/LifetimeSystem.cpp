@@ -5,12 +5,18 @@
 ///-------------------------------------------------------------------------------------------------
 
 #include "LifetimeSystem.h"
+#include "Profiler.h"
 
 #include "MaterialComponent.h"
 
 LifetimeSystem::LifetimeSystem()
 {
 	this->m_WorldSystem = ECS::ECS_Engine->GetSystemManager()->GetSystem<WorldSystem>();
+
+	// kills are queued in the world system, so lifetime system may be updated concurrently with other systems
+	WritesComponents<LifetimeComponent, MaterialComponent>();
+	WritesSystems<WorldSystem>();
+
 	RegisterEventCallbacks();
 }
 
@@ -22,6 +28,8 @@ LifetimeSystem::~LifetimeSystem()
 
 void LifetimeSystem::Update(float dt)
 {
+	PROFILE_SCOPE("LifetimeSystem::Update");
+
 	auto ltc = this->m_ActiveLifetimeComponents.begin();
 	while (ltc != this->m_ActiveLifetimeComponents.end())
 	{
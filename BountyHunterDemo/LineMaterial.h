@@ -20,7 +20,7 @@ class LineMaterial : public IMaterial
 		SHADER_DEFINE_INPUT_POSITION_VERTEX_ATTRIBUTE
 		SHADER_DEFINE_INPUT_COLOR_VERTEX_ATTRIBUTE
 
-		SHADER_DEFINE_UNIFORM(SHADER_UNIFORM_PROJECTION_TRANSFORM, "mat4")
+		SHADER_DEFINE_CAMERA_UNIFORM_BLOCK
 
 		"out " SHADER_IN_VERTEX_ATTRIBUTE_COLOR_TYPE " varColor;\n"
 
@@ -71,14 +71,6 @@ public:
 	{
 	}
 
-	virtual void SetViewProjectionTransform(const float* view, const float* proj) override
-	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniformMatrix4fv((*this->m_ShaderProgram)(SHADER_UNIFORM_PROJECTION_TRANSFORM), 1, GL_FALSE, (const GLfloat*)proj);
-		}
-	}
-
 	virtual const MaterialVertexAttributeLoc GetPositionVertexAttributeLocation() const override
 	{
 		return POSITION_MATERIAL_VERTEX_ATTRIBUTE_LOC;
@@ -100,20 +92,19 @@ public:
 	}
 
 
-	virtual void SetUniform4fv(const char* uniformName, const float* vec4) override
+	virtual const MaterialUniformLoc GetUniformLocation(const char* uniformName) const override
+	{
+		return this->m_ShaderProgram != nullptr ? (*this->m_ShaderProgram)(uniformName) : INVALID_MATERIAL_UNIFORM_LOC;
+	}
+
+	virtual void SetUniform4fv(MaterialUniformLoc uniform, const float* vec4) override
 	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniform4fv((*this->m_ShaderProgram)(uniformName), 1, (const GLfloat*)vec4);
-		}
+		glUniform4fv(uniform, 1, (const GLfloat*)vec4);
 	}
 
-	virtual void SetUniformMatrix4fv(const char* uniformName, const float* mat4) override
+	virtual void SetUniformMatrix4fv(MaterialUniformLoc uniform, const float* mat4) override
 	{
-		if (this->m_ShaderProgram != nullptr)
-		{
-			glUniformMatrix4fv((*this->m_ShaderProgram)(uniformName), 1, GL_FALSE, (const GLfloat*)mat4);
-		}
+		glUniformMatrix4fv(uniform, 1, GL_FALSE, (const GLfloat*)mat4);
 	}
 
 }; // class LineMaterial
@@ -9,8 +9,12 @@
 #define __MATERIAL_H__
 
 // incldue materials
+#ifdef HEADLESS_SIMULATION
+#include "NullMaterial.h"
+#else
 #include "DefaultMaterial.h"
 #include "LineMaterial.h"
+#endif
 
 class Material
 {
@@ -34,8 +38,6 @@ public:
 
 	inline void SetModelTransform(const float* model) { this->m_materialData->SetModelTransform(model); }
 
-	inline void SetViewProjectionTransform(const float* view, const float* proj) { this->m_materialData->SetViewProjectionTransform(view, proj); };
-
 	inline const MaterialVertexAttributeLoc GetPositionVertexAttributeLocation() const { return this->m_materialData->GetPositionVertexAttributeLocation(); }
 
 	inline const MaterialVertexAttributeLoc GetNormalVertexAttributeLocation() const { return this->m_materialData->GetNormalVertexAttributeLocation(); }
@@ -44,8 +46,16 @@ public:
 
 	inline const MaterialVertexAttributeLoc GetColorVertexAttributeLocation() const { return this->m_materialData->GetColorVertexAttributeLocation(); }
 
-	inline void SetUniform4fv(const char* uniformName, const float* vec4) { this->m_materialData->SetUniform4fv(uniformName, vec4); }
-	inline void SetUniformMatrix4fv(const char* uniformName, const float* mat4) { this->m_materialData->SetUniformMatrix4fv(uniformName, mat4); }
+	inline const MaterialVertexAttributeLoc GetInstanceModelTransformVertexAttributeLocation() const { return this->m_materialData->GetInstanceModelTransformVertexAttributeLocation(); }
+
+	inline const MaterialVertexAttributeLoc GetInstanceColorVertexAttributeLocation() const { return this->m_materialData->GetInstanceColorVertexAttributeLocation(); }
+
+	inline bool IsInstanced() const { return (GetInstanceModelTransformVertexAttributeLocation() != INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC) && (GetInstanceColorVertexAttributeLocation() != INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC); }
+
+	inline const MaterialUniformLoc GetUniformLocation(const char* uniformName) const { return this->m_materialData->GetUniformLocation(uniformName); }
+
+	inline void SetUniform4fv(MaterialUniformLoc uniform, const float* vec4) { this->m_materialData->SetUniform4fv(uniform, vec4); }
+	inline void SetUniformMatrix4fv(MaterialUniformLoc uniform, const float* mat4) { this->m_materialData->SetUniformMatrix4fv(uniform, mat4); }
 };
 
 #endif // __MATERIAL_H__
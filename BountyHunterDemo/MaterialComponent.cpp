@@ -10,7 +10,8 @@ const Color4f MaterialComponent::DEFAULT_COLOR0(0.8f, 0.8f, 8.0f, 1.0f);
 
 MaterialComponent::MaterialComponent(const Material& material, Color4f color) : 
 	Material(material),
-	m_Color0(color)
+	m_Color0(color),
+	m_Color0Loc(material.GetUniformLocation(SHADER_UNIFORM_COLOR0))
 {}
 
 MaterialComponent::~MaterialComponent()
@@ -18,7 +19,7 @@ MaterialComponent::~MaterialComponent()
 
 void MaterialComponent::Apply()
 {
-	SetUniform4fv(SHADER_UNIFORM_COLOR0, (const float*)&this->m_Color0[0]);
+	SetUniform4fv(this->m_Color0Loc, (const float*)&this->m_Color0[0]);
 }
 
 void MaterialComponent::SetColor(float r, float g, float b, float a)
@@ -20,6 +20,9 @@ private:
 
 	Color4f m_Color0;
 
+	// location of the color uniform, resolved once on construction
+	MaterialUniformLoc m_Color0Loc;
+
 public:
 
 	MaterialComponent(const Material& material, Color4f color = DEFAULT_COLOR0);
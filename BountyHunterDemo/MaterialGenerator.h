@@ -11,6 +11,8 @@
 #include "Material.h"
 
 #include <vector>
+#include <assert.h>
+#include <stdio.h>
 
 class Material;
 
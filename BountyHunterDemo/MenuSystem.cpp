@@ -71,6 +71,11 @@ void MenuSystem::OnKeyDownEvent(const KeyDownEvent* event)
 			ECS::ECS_Engine->SendEvent<ToggleDebugDrawEvent>();
 			break;
 
+		// toggle simulation speed (ticks per rendered frame)
+		case SDLK_F3:
+			ECS::ECS_Engine->SendEvent<ToggleSimulationSpeedEvent>();
+			break;
+
 		//--------------------------------------------
 		// GAME 'MENU' OPTIONS
 		//--------------------------------------------
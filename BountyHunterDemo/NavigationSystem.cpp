@@ -0,0 +1,377 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	NavigationSystem.cpp.
+///
+/// Summary:	Implements the navigation system class.
+///-------------------------------------------------------------------------------------------------
+
+#include "NavigationSystem.h"
+#include "Profiler.h"
+
+#include "Collector.h"
+#include "Stash.h"
+
+#include <algorithm>
+#include <limits>
+
+constexpr WorldGrid	NavigationSystem::GRID;
+constexpr int		NavigationSystem::NEIGHBOUR_X[8];
+constexpr int		NavigationSystem::NEIGHBOUR_Y[8];
+constexpr float		NavigationSystem::NEIGHBOUR_STEP[8];
+constexpr uint8_t	NavigationSystem::NO_NEIGHBOUR;
+
+NavigationSystem::NavigationSystem() :
+	m_FlowField(MAX_PLAYER),
+	m_Footprint(MAX_PLAYER),
+	m_LastFootprint(MAX_PLAYER),
+	m_Occupancy(GRID.GetCellCount(), 0),
+	m_NextFlowField(0),
+	m_IsAffected(GRID.GetCellCount(), 0)
+{
+	ReadsComponents<TransformComponent>();
+
+	RegisterEventCallbacks();
+}
+
+NavigationSystem::~NavigationSystem()
+{
+	UnregisterEventCallbacks();
+}
+
+void NavigationSystem::Update(float dt)
+{
+	PROFILE_SCOPE("NavigationSystem::Update");
+
+	UpdateOccupancy();
+
+	const size_t N = this->m_FlowField.size();
+
+	size_t updates = 0;
+	for (size_t i = 0; i < N && updates < NAVIGATION_FIELD_UPDATES_PER_TICK; ++i)
+	{
+		const size_t next = (this->m_NextFlowField + i) % N;
+
+		const FlowField& field = this->m_FlowField[next];
+		if (field.m_Stash == nullptr || (field.m_Valid == true && field.m_ChangedCells.empty() == true))
+			continue;
+
+		UpdateFlowField(next);
+
+		this->m_NextFlowField = (next + 1) % N;
+		++updates;
+	}
+}
+
+void NavigationSystem::Reset()
+{
+	this->m_Collector.Clear();
+
+	for (auto& cells : this->m_Footprint)
+		cells.clear();
+
+	for (auto& cells : this->m_LastFootprint)
+		cells.clear();
+
+	std::fill(this->m_Occupancy.begin(), this->m_Occupancy.end(), 0);
+
+	for (auto& field : this->m_FlowField)
+		field = FlowField();
+
+	this->m_NextFlowField = 0;
+}
+
+void NavigationSystem::UpdateOccupancy()
+{
+	for (auto& cells : this->m_Footprint)
+		cells.clear();
+
+	for (auto& it : this->m_Collector)
+	{
+		const Collector* collector = (const Collector*)it.m_GameObject;
+		if (collector->IsActive() == false)
+			continue;
+
+		const PlayerId player = collector->GetPlayer();
+		if (player >= this->m_Footprint.size())
+		{
+			this->m_Footprint.resize(player + 1);
+			this->m_LastFootprint.resize(player + 1);
+		}
+
+		const Transform2D* T = collector->GetComponent<TransformComponent>()->AsTransform2D();
+
+		const Position2D& P = T->GetPosition();
+		const float R = 0.5f * glm::max(T->GetScale().x, T->GetScale().y);
+
+		// all cells overlapped by the collector's bounds
+		const int X0 = GRID.CellX(P.x - R), X1 = GRID.CellX(P.x + R);
+		const int Y0 = GRID.CellY(P.y - R), Y1 = GRID.CellY(P.y + R);
+
+		for (int y = Y0; y <= Y1; ++y)
+			for (int x = X0; x <= X1; ++x)
+				this->m_Footprint[player].push_back(y * GRID.m_CellsX + x);
+	}
+
+	// fields only change, if a collector entered or left a cell
+	for (size_t player = 0; player < this->m_Footprint.size(); ++player)
+	{
+		CellList& footprint = this->m_Footprint[player];
+		CellList& lastFootprint = this->m_LastFootprint[player];
+
+		std::sort(footprint.begin(), footprint.end());
+		if (footprint == lastFootprint)
+			continue;
+
+		for (auto cell : lastFootprint)
+			--this->m_Occupancy[cell];
+
+		for (auto cell : footprint)
+			++this->m_Occupancy[cell];
+
+		// note: a player's own field is not affected, its own collector is not an obstacle to it
+		for (size_t f = 0; f < this->m_FlowField.size(); ++f)
+		{
+			FlowField& field = this->m_FlowField[f];
+			if (f == player || field.m_Valid == false)
+				continue;
+
+			field.m_ChangedCells.insert(field.m_ChangedCells.end(), lastFootprint.begin(), lastFootprint.end());
+			field.m_ChangedCells.insert(field.m_ChangedCells.end(), footprint.begin(), footprint.end());
+		}
+
+		lastFootprint = footprint;
+	}
+}
+
+void NavigationSystem::UpdateFlowField(PlayerId playerId)
+{
+	FlowField& field = this->m_FlowField[playerId];
+
+	// leave the player's own collector out of the cell cost while the field is updated
+	const CellList* ownFootprint = playerId < this->m_Footprint.size() ? &this->m_Footprint[playerId] : nullptr;
+
+	if (ownFootprint != nullptr)
+		for (auto cell : *ownFootprint)
+			--this->m_Occupancy[cell];
+
+	if (field.m_Valid == false)
+		ComputeFlowField(field);
+	else
+		RepairFlowField(field);
+
+	if (ownFootprint != nullptr)
+		for (auto cell : *ownFootprint)
+			++this->m_Occupancy[cell];
+}
+
+void NavigationSystem::ComputeFlowField(FlowField& field)
+{
+	PROFILE_NESTED_SCOPE("NavigationSystem::ComputeFlowField");
+
+	field.m_Goal = GRID.Cell(field.m_Stash->GetComponent<TransformComponent>()->AsTransform2D()->GetPosition());
+
+	std::fill(field.m_Distance.begin(), field.m_Distance.end(), std::numeric_limits<float>::max());
+	std::fill(field.m_Next.begin(), field.m_Next.end(), NO_NEIGHBOUR);
+
+	field.m_Distance[field.m_Goal] = 0.0f;
+
+	this->m_OpenCells.clear();
+	this->m_OpenCells.push_back({ 0.0f, field.m_Goal });
+
+	PropagateFlowField(field);
+
+	field.m_ChangedCells.clear();
+	field.m_Valid = true;
+}
+
+void NavigationSystem::RepairFlowField(FlowField& field)
+{
+	PROFILE_NESTED_SCOPE("NavigationSystem::RepairFlowField");
+
+	std::vector<float>& D = field.m_Distance;
+	std::vector<uint8_t>& NEXT = field.m_Next;
+
+	// the changed cells and all cells, whose next cells lead through them
+	this->m_AffectedCells.clear();
+	for (auto cell : field.m_ChangedCells)
+	{
+		// note: the stash's cell stays the goal, whatever it costs to enter
+		if (cell == field.m_Goal || this->m_IsAffected[cell] == 1)
+			continue;
+
+		this->m_IsAffected[cell] = 1;
+		this->m_AffectedCells.push_back(cell);
+	}
+
+	for (size_t i = 0; i < this->m_AffectedCells.size(); ++i)
+	{
+		const uint32_t cell = this->m_AffectedCells[i];
+
+		const int x = cell % GRID.m_CellsX;
+		const int y = cell / GRID.m_CellsX;
+
+		for (int n = 0; n < 8; ++n)
+		{
+			const int nx = x + NEIGHBOUR_X[n];
+			const int ny = y + NEIGHBOUR_Y[n];
+
+			if (nx < 0 || nx >= GRID.m_CellsX || ny < 0 || ny >= GRID.m_CellsY)
+				continue;
+
+			const uint32_t neighbour = ny * GRID.m_CellsX + nx;
+			if (this->m_IsAffected[neighbour] == 0 && NEXT[neighbour] == 7 - n)
+			{
+				this->m_IsAffected[neighbour] = 1;
+				this->m_AffectedCells.push_back(neighbour);
+			}
+		}
+	}
+
+	for (auto cell : this->m_AffectedCells)
+	{
+		D[cell] = std::numeric_limits<float>::max();
+		NEXT[cell] = NO_NEIGHBOUR;
+	}
+
+	// seed the affected cells from their unaffected neighbours
+	this->m_OpenCells.clear();
+	for (auto cell : this->m_AffectedCells)
+	{
+		const int x = cell % GRID.m_CellsX;
+		const int y = cell / GRID.m_CellsX;
+
+		const float COST = GetCellCost(cell);
+
+		for (int n = 0; n < 8; ++n)
+		{
+			const int nx = x + NEIGHBOUR_X[n];
+			const int ny = y + NEIGHBOUR_Y[n];
+
+			if (nx < 0 || nx >= GRID.m_CellsX || ny < 0 || ny >= GRID.m_CellsY)
+				continue;
+
+			const uint32_t neighbour = ny * GRID.m_CellsX + nx;
+			if (this->m_IsAffected[neighbour] == 1 || D[neighbour] == std::numeric_limits<float>::max())
+				continue;
+
+			const float d = D[neighbour] + NEIGHBOUR_STEP[n] * NAVIGATION_GRID_CELL_SIZE * COST;
+			if (d < D[cell])
+			{
+				D[cell] = d;
+				NEXT[cell] = n;
+			}
+		}
+
+		if (NEXT[cell] != NO_NEIGHBOUR)
+			this->m_OpenCells.push_back({ D[cell], cell });
+	}
+
+	for (auto cell : this->m_AffectedCells)
+		this->m_IsAffected[cell] = 0;
+
+	std::make_heap(this->m_OpenCells.begin(), this->m_OpenCells.end());
+
+	PropagateFlowField(field);
+
+	field.m_ChangedCells.clear();
+}
+
+void NavigationSystem::PropagateFlowField(FlowField& field)
+{
+	std::vector<float>& D = field.m_Distance;
+	std::vector<uint8_t>& NEXT = field.m_Next;
+
+	while (this->m_OpenCells.empty() == false)
+	{
+		std::pop_heap(this->m_OpenCells.begin(), this->m_OpenCells.end());
+		const OpenCell open = this->m_OpenCells.back();
+		this->m_OpenCells.pop_back();
+
+		// already reached cheaper
+		if (open.m_Distance > D[open.m_Cell])
+			continue;
+
+		const int x = open.m_Cell % GRID.m_CellsX;
+		const int y = open.m_Cell / GRID.m_CellsX;
+
+		for (int n = 0; n < 8; ++n)
+		{
+			const int nx = x + NEIGHBOUR_X[n];
+			const int ny = y + NEIGHBOUR_Y[n];
+
+			if (nx < 0 || nx >= GRID.m_CellsX || ny < 0 || ny >= GRID.m_CellsY)
+				continue;
+
+			const uint32_t neighbour = ny * GRID.m_CellsX + nx;
+			const float d = open.m_Distance + NEIGHBOUR_STEP[n] * NAVIGATION_GRID_CELL_SIZE * GetCellCost(neighbour);
+
+			if (d < D[neighbour])
+			{
+				D[neighbour] = d;
+
+				// the neighbour continues back to this cell
+				NEXT[neighbour] = 7 - n;
+
+				this->m_OpenCells.push_back({ d, neighbour });
+				std::push_heap(this->m_OpenCells.begin(), this->m_OpenCells.end());
+			}
+		}
+	}
+}
+
+void NavigationSystem::RegisterEventCallbacks()
+{
+	RegisterEventCallback(&NavigationSystem::OnGameObjectCreated);
+	RegisterEventCallback(&NavigationSystem::OnGameObjectDestroyed);
+}
+
+void NavigationSystem::UnregisterEventCallbacks()
+{
+	UnregisterEventCallback(&NavigationSystem::OnGameObjectCreated);
+	UnregisterEventCallback(&NavigationSystem::OnGameObjectDestroyed);
+}
+
+void NavigationSystem::OnGameObjectCreated(const GameObjectCreated* event)
+{
+	if (event->m_EntityTypeID == Collector::STATIC_ENTITY_TYPE_ID)
+	{
+		this->m_Collector.Add(event->m_EntityID);
+	}
+	else if (event->m_EntityTypeID == Stash::STATIC_ENTITY_TYPE_ID)
+	{
+		const Stash* stash = (const Stash*)ECS::ECS_Engine->GetEntityManager()->GetEntity(event->m_EntityID);
+		assert(stash != nullptr && "Failed to retrieve entity by id!");
+
+		const PlayerId owner = stash->GetOwner();
+		if (owner >= this->m_FlowField.size())
+			this->m_FlowField.resize(owner + 1);
+
+		FlowField& field = this->m_FlowField[owner];
+
+		field.m_StashId = event->m_EntityID;
+		field.m_Stash = stash;
+		field.m_Distance.resize(GRID.GetCellCount());
+		field.m_Next.resize(GRID.GetCellCount());
+
+		// computed with the next update
+		field.m_Valid = false;
+	}
+}
+
+void NavigationSystem::OnGameObjectDestroyed(const GameObjectDestroyed* event)
+{
+	if (event->m_EntityTypeID == Collector::STATIC_ENTITY_TYPE_ID)
+	{
+		this->m_Collector.Remove(event->m_EntityID);
+	}
+	else if (event->m_EntityTypeID == Stash::STATIC_ENTITY_TYPE_ID)
+	{
+		for (auto& field : this->m_FlowField)
+		{
+			if (field.m_StashId == event->m_EntityID)
+			{
+				field = FlowField();
+				return;
+			}
+		}
+	}
+}
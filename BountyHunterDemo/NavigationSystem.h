@@ -0,0 +1,202 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	NavigationSystem.h.
+///
+/// Summary:	Declares the navigation system class. The navigation system keeps a flow field over
+/// the world bounds for each stash. A flow field stores for every grid cell the direction of the
+/// cheapest path to the stash, where cells covered by other players' collectors are expensive to
+/// cross. So all collectors heading to the same stash share one computation and just look up their
+/// direction.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __NAVIGATION_SYSTEM_H__
+#define __NAVIGATION_SYSTEM_H__
+
+#include <ECS/ECS.h>
+
+#include <vector>
+
+#include "GameObject.h"
+#include "GameObjectTracker.h"
+#include "WorldGrid.h"
+
+class NavigationSystem : public ECS::System<NavigationSystem>, public ECS::Event::IEventListener
+{
+	static constexpr WorldGrid	GRID		{ NAVIGATION_GRID_CELL_SIZE };
+
+	// the 8 neighbours of a cell, neighbour n and 7 - n are opposite
+	static constexpr int		NEIGHBOUR_X[8]		{ -1,  0,  1, -1, 1, -1, 0, 1 };
+	static constexpr int		NEIGHBOUR_Y[8]		{ -1, -1, -1,  0, 0,  1, 1, 1 };
+	static constexpr float		NEIGHBOUR_STEP[8]	{ 1.41421356f, 1.0f, 1.41421356f, 1.0f, 1.0f, 1.41421356f, 1.0f, 1.41421356f };
+
+	static constexpr uint8_t	NO_NEIGHBOUR { 0xFF };
+
+	using CellList = std::vector<uint32_t>;
+
+	///-------------------------------------------------------------------------------------------------
+	/// Struct:	FlowField
+	///
+	/// Summary:	Flow field to a stash. After collectors have moved to other cells, only the cells
+	/// whose cheapest path crosses the changed cells are recomputed. Until then the field stays in
+	/// use as it is.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	struct FlowField
+	{
+		GameObjectId				m_StashId;
+		const ECS::IEntity*			m_Stash;
+
+		// the stash's cell
+		uint32_t					m_Goal;
+
+		// path cost from each cell to the stash
+		std::vector<float>			m_Distance;
+
+		// neighbour of each cell on the cheapest path, NO_NEIGHBOUR in the stash's cell and unreachable cells
+		std::vector<uint8_t>		m_Next;
+
+		// cells whose cost changed since the field was last updated
+		CellList					m_ChangedCells;
+
+		// false, until the field was computed once
+		bool						m_Valid;
+
+		FlowField() :
+			m_StashId(INVALID_GAMEOBJECT_ID),
+			m_Stash(nullptr),
+			m_Goal(0),
+			m_Valid(false)
+		{}
+	};
+
+	// indexed by the stash's owning player
+	using FlowFields = std::vector<FlowField>;
+
+	struct OpenCell
+	{
+		float		m_Distance;
+		uint32_t	m_Cell;
+
+		// note: std heap functions build a max heap, so the nearest cell has to compare greatest
+		inline bool operator<(const OpenCell& other) const { return this->m_Distance > other.m_Distance; }
+	};
+
+private:
+
+	FlowFields				m_FlowField;
+
+	GameObjectTracker		m_Collector;
+
+	// sorted cells covered by each player's collector this and last tick, indexed by player
+	std::vector<CellList>	m_Footprint;
+	std::vector<CellList>	m_LastFootprint;
+
+	// number of collectors covering each cell
+	std::vector<uint16_t>	m_Occupancy;
+
+	// the field to update first next tick, so all fields get their turn
+	size_t					m_NextFlowField;
+
+	// search scratch buffers
+	std::vector<OpenCell>	m_OpenCells;
+	std::vector<uint8_t>	m_IsAffected;
+	CellList				m_AffectedCells;
+
+	inline float GetCellCost(uint32_t cell) const { return 1.0f + NAVIGATION_COLLECTOR_COST * this->m_Occupancy[cell]; }
+
+	void RegisterEventCallbacks();
+	void UnregisterEventCallbacks();
+
+	void OnGameObjectCreated(const GameObjectCreated* event);
+	void OnGameObjectDestroyed(const GameObjectDestroyed* event);
+
+	// gathers the cells covered by active collectors and notes the changed cells in the fields
+	void UpdateOccupancy();
+
+	// computes or repairs the player's field, ignoring the player's own collector
+	void UpdateFlowField(PlayerId playerId);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void NavigationSystem::ComputeFlowField(FlowField& field);
+	///
+	/// Summary:	Computes the path cost and next neighbour of all cells to the stash (Dijkstra over
+	/// the 8 neighbours of each cell).
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// field - 	The field.
+	///-------------------------------------------------------------------------------------------------
+
+	void ComputeFlowField(FlowField& field);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void NavigationSystem::RepairFlowField(FlowField& field);
+	///
+	/// Summary:	Updates the field to the new cost of its changed cells. The changed cells and all
+	/// cells whose cheapest path leads through them are reset and seeded from their unaffected
+	/// neighbours, then the search continues from there and only reaches further where paths got
+	/// cheaper.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// field - 	The field.
+	///-------------------------------------------------------------------------------------------------
+
+	void RepairFlowField(FlowField& field);
+
+	// runs the search from the open cells, until no path gets cheaper
+	void PropagateFlowField(FlowField& field);
+
+public:
+
+	NavigationSystem();
+	virtual ~NavigationSystem();
+
+	virtual void Update(float dt) override;
+
+	void Reset();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	inline bool NavigationSystem::GetFlowDirection(PlayerId playerId, const Position2D& position, glm::vec2& direction) const
+	///
+	/// Summary:	Looks up the direction to follow from position to the player's stash.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// playerId - 		The stash's owning player.
+	/// position - 		The position.
+	/// direction - 	[out] The normalized direction.
+	///
+	/// Returns:	False, if there is no field for the player's stash yet, position is in the stash's
+	/// cell or the stash cannot be reached from position.
+	///-------------------------------------------------------------------------------------------------
+
+	inline bool GetFlowDirection(PlayerId playerId, const Position2D& position, glm::vec2& direction) const
+	{
+		if (playerId >= this->m_FlowField.size() || this->m_FlowField[playerId].m_Valid == false)
+			return false;
+
+		const uint8_t next = this->m_FlowField[playerId].m_Next[GRID.Cell(position)];
+		if (next == NO_NEIGHBOUR)
+			return false;
+
+		direction = glm::vec2(NEIGHBOUR_X[next], NEIGHBOUR_Y[next]) / NEIGHBOUR_STEP[next];
+
+		return true;
+	}
+
+}; // class NavigationSystem
+
+#endif // __NAVIGATION_SYSTEM_H__
@@ -0,0 +1,66 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	NullMaterial.h.
+///
+/// Summary:	Declares the null material class. A null material has no shader program and is used
+/// in place of all other materials in a headless simulation build, where there is no OpenGL context.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __NULL_MATERIAL_H__
+#define __NULL_MATERIAL_H__
+
+#include "IMaterial.h"
+
+
+template<IMaterial::Type TYPE>
+class NullMaterial : public IMaterial
+{
+public:
+
+	static constexpr Type MATERIAL_TYPE { TYPE };
+
+	NullMaterial()
+	{}
+
+	virtual ~NullMaterial()
+	{}
+
+	virtual inline const MaterialID GetMaterialID() const override { return MATERIAL_TYPE; }
+
+	virtual void Use() const override
+	{}
+
+	virtual void Unuse() const override
+	{}
+
+	virtual bool Initialize() override { return true; }
+
+	virtual void Release() override
+	{}
+
+	virtual void SetModelTransform(const float* model) override
+	{}
+
+	virtual const MaterialVertexAttributeLoc GetPositionVertexAttributeLocation() const override { return INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC; }
+
+	virtual const MaterialVertexAttributeLoc GetNormalVertexAttributeLocation() const override { return INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC; }
+
+	virtual const MaterialVertexAttributeLoc GetTexCoordVertexAttributeLocation() const override { return INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC; }
+
+	virtual const MaterialVertexAttributeLoc GetColorVertexAttributeLocation() const override { return INVALID_MATERIAL_VERTEX_ATTRIBUTE_LOC; }
+
+
+	virtual const MaterialUniformLoc GetUniformLocation(const char* uniformName) const override { return INVALID_MATERIAL_UNIFORM_LOC; }
+
+	virtual void SetUniform4fv(MaterialUniformLoc uniform, const float* vec4) override
+	{}
+
+	virtual void SetUniformMatrix4fv(MaterialUniformLoc uniform, const float* mat4) override
+	{}
+
+}; // class NullMaterial
+
+// in a headless build every material type is a null material
+using DefaultMaterial	= NullMaterial<IMaterial::DEFAULT_MATERIAL>;
+using LineMaterial		= NullMaterial<IMaterial::LINE_MATERIAL>;
+
+#endif // __NULL_MATERIAL_H__
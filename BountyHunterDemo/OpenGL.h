@@ -1,6 +1,35 @@
 #ifndef __OPEN_GL_H__
 #define __OPEN_GL_H__
 
+#ifdef HEADLESS_SIMULATION
+
+/** Headless simulation
+	There is no OpenGL context in a headless build. Only the basic OpenGL scalar types
+	and enums are provided, so that shape data can still be declared.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int	GLenum;
+typedef unsigned char	GLboolean;
+typedef int				GLint;
+typedef unsigned int	GLuint;
+typedef float			GLfloat;
+typedef unsigned short	GLushort;
+typedef char			GLchar;
+typedef void			GLvoid;
+typedef ptrdiff_t		GLsizeiptr;
+typedef ptrdiff_t		GLintptr;
+
+#define GL_FALSE				0
+#define GL_TRUE					1
+#define GL_UNSIGNED_SHORT		0x1403
+#define GL_FLOAT				0x1406
+
+#define glGetLastError()
+
+#else
+
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 
@@ -25,6 +54,8 @@ void __glGetLastErrorImpl(const char* file, int line, const char *func);
 #define glGetLastError()
 #endif
 
+#endif // HEADLESS_SIMULATION
+
 
 
 typedef GLfloat		VertexPositionData;
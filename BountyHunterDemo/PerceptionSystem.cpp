@@ -0,0 +1,196 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	PerceptionSystem.cpp.
+///
+/// Summary:	Implements the perception system class.
+///-------------------------------------------------------------------------------------------------
+
+#include "PerceptionSystem.h"
+#include "Profiler.h"
+
+#include "BountyRadar.h"
+#include "CollectorAvoider.h"
+
+#include "Collector.h"
+#include "Bounty.h"
+
+#include <algorithm>
+
+constexpr WorldGrid PerceptionSystem::GRID;
+
+void PerceptionSystem::PerceptionGrid::Build()
+{
+	const size_t CELLS = this->m_CellStart.size() - 1;
+
+	std::fill(this->m_CellStart.begin(), this->m_CellStart.end(), 0);
+	this->m_EntryCell.resize(this->m_Unsorted.size());
+	this->m_MaxRadius = 0.0f;
+
+	// count entries per cell
+	for (size_t i = 0; i < this->m_Unsorted.size(); ++i)
+	{
+		const Entry& E = this->m_Unsorted[i];
+
+		this->m_EntryCell[i] = GRID.Cell(E.m_Position);
+		this->m_CellStart[this->m_EntryCell[i] + 1]++;
+
+		this->m_MaxRadius = glm::max(this->m_MaxRadius, E.m_Radius);
+	}
+
+	// prefix sum, m_CellStart[cell] is the first entry of the cell
+	for (size_t c = 0; c < CELLS; ++c)
+		this->m_CellStart[c + 1] += this->m_CellStart[c];
+
+	// scatter entries, m_CellStart[cell] is used as insert position and ends up as the cell end
+	this->m_Entries.resize(this->m_Unsorted.size());
+	for (size_t i = 0; i < this->m_Unsorted.size(); ++i)
+		this->m_Entries[this->m_CellStart[this->m_EntryCell[i]]++] = this->m_Unsorted[i];
+
+	// undo the insert position shift
+	for (size_t c = CELLS; c > 0; --c)
+		this->m_CellStart[c] = this->m_CellStart[c - 1];
+	this->m_CellStart[0] = 0;
+}
+
+PerceptionSystem::PerceptionSystem()
+{
+	RegisterEventCallbacks();
+}
+
+PerceptionSystem::~PerceptionSystem()
+{
+	UnregisterEventCallbacks();
+}
+
+void PerceptionSystem::PreUpdate(float dt)
+{
+	PROFILE_SCOPE("PerceptionSystem::PreUpdate");
+
+	BuildGrid(this->m_BountyGrid, this->m_Bounty);
+	BuildGrid(this->m_CollectorGrid, this->m_Collector);
+
+	// batch all ai queries
+	ECS::ECS_Engine->GetComponentManager()->ForEachComponent<BountyRadar>([&](BountyRadar& radar) { QueryBountyRadar(&radar); });
+
+	ECS::ECS_Engine->GetComponentManager()->ForEachComponent<CollectorAvoider>([&](CollectorAvoider& avoider) { QueryCollectorAvoider(&avoider); });
+}
+
+void PerceptionSystem::Reset()
+{
+	this->m_Bounty.Clear();
+	this->m_Collector.Clear();
+}
+
+void PerceptionSystem::BuildGrid(PerceptionGrid& grid, const GameObjectTracker& gameObjects)
+{
+	grid.m_Unsorted.clear();
+
+	for (auto& it : gameObjects)
+	{
+		ECS::IEntity* gameObject = it.m_GameObject;
+		if (gameObject->IsActive() == false)
+			continue;
+
+		const Transform2D* T = gameObject->GetComponent<TransformComponent>()->AsTransform2D();
+
+		grid.m_Unsorted.push_back({ T->GetPosition(), 0.5f * glm::max(T->GetScale().x, T->GetScale().y), gameObject });
+	}
+
+	grid.Build();
+}
+
+void PerceptionSystem::QueryBountyRadar(BountyRadar* radar)
+{
+	radar->m_DetectedBounty.Clear();
+
+	const ECS::IEntity* owner = ECS::ECS_Engine->GetEntityManager()->GetEntity(radar->GetOwner());
+	if (owner == nullptr || owner->IsActive() == false)
+		return;
+
+	const Transform2D* T	= owner->GetComponent<TransformComponent>()->AsTransform2D();
+	const Position2D& P		= T->GetPosition();
+
+	// radar looks along the collector's up axis
+	const glm::vec2 F		= glm::normalize(T->GetUp());
+	const float COS_HALF_LOS = glm::cos(radar->GetLineOfSight() * 0.5f);
+
+	const float REACH		= radar->GetViewDistance() + this->m_BountyGrid.m_MaxRadius;
+
+	this->m_BountyGrid.Query(P - glm::vec2(REACH), P + glm::vec2(REACH), [&](const PerceptionGrid::Entry& bounty)
+	{
+		const glm::vec2 D	= bounty.m_Position - P;
+		const float SQ_D	= glm::dot(D, D);
+		const float R		= radar->GetViewDistance() + bounty.m_Radius;
+
+		if (SQ_D > R * R)
+			return;
+
+		// in cone of view or touching the collector
+		if (SQ_D <= bounty.m_Radius * bounty.m_Radius || glm::dot(D, F) >= COS_HALF_LOS * glm::sqrt(SQ_D))
+		{
+			const Bounty* B = (const Bounty*)bounty.m_GameObject;
+			radar->m_DetectedBounty.Add(B, bounty.m_Position, B->GetBounty());
+		}
+	});
+}
+
+void PerceptionSystem::QueryCollectorAvoider(CollectorAvoider* avoider)
+{
+	avoider->m_DetectedCollector.clear();
+
+	const ECS::IEntity* owner = ECS::ECS_Engine->GetEntityManager()->GetEntity(avoider->GetOwner());
+	if (owner == nullptr || owner->IsActive() == false)
+		return;
+
+	const Transform2D* T	= owner->GetComponent<TransformComponent>()->AsTransform2D();
+	const Position2D& P		= T->GetPosition();
+
+	// avoider box spans [0, view distance] along the collector's up axis and [-width, width] along its right axis
+	const glm::vec2 F		= glm::normalize(T->GetUp());
+	const glm::vec2 S		= glm::normalize(T->GetRight());
+
+	const float VIEW		= avoider->GetViewDistance();
+	const float WIDTH		= avoider->GetWidth();
+
+	const glm::vec2 REACH	= glm::vec2(VIEW + WIDTH + this->m_CollectorGrid.m_MaxRadius);
+
+	this->m_CollectorGrid.Query(P - REACH, P + REACH, [&](const PerceptionGrid::Entry& collector)
+	{
+		if (collector.m_GameObject == owner)
+			return;
+
+		const glm::vec2 D	= collector.m_Position - P;
+		const float FD		= glm::dot(D, F);
+		const float SD		= glm::dot(D, S);
+
+		if (FD >= -collector.m_Radius && FD <= VIEW + collector.m_Radius && glm::abs(SD) <= WIDTH + collector.m_Radius)
+			avoider->m_DetectedCollector.push_back((const Collector*)collector.m_GameObject);
+	});
+}
+
+void PerceptionSystem::RegisterEventCallbacks()
+{
+	RegisterEventCallback(&PerceptionSystem::OnGameObjectCreated);
+	RegisterEventCallback(&PerceptionSystem::OnGameObjectDestroyed);
+}
+
+void PerceptionSystem::UnregisterEventCallbacks()
+{
+	UnregisterEventCallback(&PerceptionSystem::OnGameObjectCreated);
+	UnregisterEventCallback(&PerceptionSystem::OnGameObjectDestroyed);
+}
+
+void PerceptionSystem::OnGameObjectCreated(const GameObjectCreated* event)
+{
+	if (event->m_EntityTypeID == Bounty::STATIC_ENTITY_TYPE_ID)
+		this->m_Bounty.Add(event->m_EntityID);
+	else if (event->m_EntityTypeID == Collector::STATIC_ENTITY_TYPE_ID)
+		this->m_Collector.Add(event->m_EntityID);
+}
+
+void PerceptionSystem::OnGameObjectDestroyed(const GameObjectDestroyed* event)
+{
+	if (event->m_EntityTypeID == Bounty::STATIC_ENTITY_TYPE_ID)
+		this->m_Bounty.Remove(event->m_EntityID);
+	else if (event->m_EntityTypeID == Collector::STATIC_ENTITY_TYPE_ID)
+		this->m_Collector.Remove(event->m_EntityID);
+}
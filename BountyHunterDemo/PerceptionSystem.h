@@ -0,0 +1,136 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	PerceptionSystem.h.
+///
+/// Summary:	Declares the perception system class. The perception system answers what the ai can
+/// see. Once per tick it sorts all active bounty and collector into uniform grids over the world
+/// bounds and then runs the queries of all BountyRadar (cone of view) and CollectorAvoider (box)
+/// components in one batch.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __PERCEPTION_SYSTEM_H__
+#define __PERCEPTION_SYSTEM_H__
+
+#include <ECS/ECS.h>
+
+#include <vector>
+
+#include "GameObject.h"
+#include "GameObjectTracker.h"
+#include "WorldGrid.h"
+
+class BountyRadar;
+class CollectorAvoider;
+
+class PerceptionSystem : public ECS::System<PerceptionSystem>, public ECS::Event::IEventListener
+{
+	static constexpr WorldGrid	GRID { PERCEPTION_GRID_CELL_SIZE };
+
+	///-------------------------------------------------------------------------------------------------
+	/// Struct:	PerceptionGrid
+	///
+	/// Summary:	Entries sorted into the cells of GRID (counting sort), so the entries of a cell are
+	/// stored contiguously in m_Entries[m_CellStart[cell], m_CellStart[cell + 1]).
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	struct PerceptionGrid
+	{
+		struct Entry
+		{
+			Position2D				m_Position;
+
+			// bounding radius of the game object
+			float					m_Radius;
+
+			const ECS::IEntity*		m_GameObject;
+		};
+
+		using Entries = std::vector<Entry>;
+
+		Entries						m_Entries;
+		std::vector<uint32_t>		m_CellStart;
+
+		// largest entry radius, queries are extended by it
+		float						m_MaxRadius;
+
+		// build scratch buffers
+		Entries						m_Unsorted;
+		std::vector<uint32_t>		m_EntryCell;
+
+		PerceptionGrid() :
+			m_CellStart(GRID.GetCellCount() + 1, 0),
+			m_MaxRadius(0.0f)
+		{}
+
+		// sorts the gathered m_Unsorted entries into the grid
+		void Build();
+
+		///-------------------------------------------------------------------------------------------------
+		/// Fn:	template<class F> void PerceptionGrid::Query(const Position2D& min, const Position2D& max, F&& visitor) const
+		///
+		/// Summary:	Visits all entries of the cells overlapping the box [min, max]. Entries
+		/// outside the box may be visited too, the visitor has to do the exact test.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///
+		/// Parameters:
+		/// min - 	  	The box minimum.
+		/// max - 	  	The box maximum.
+		/// visitor - 	The visitor, called with each 'const Entry&'.
+		///-------------------------------------------------------------------------------------------------
+
+		template<class F>
+		void Query(const Position2D& min, const Position2D& max, F&& visitor) const
+		{
+			const int X0 = GRID.CellX(min.x), X1 = GRID.CellX(max.x);
+			const int Y0 = GRID.CellY(min.y), Y1 = GRID.CellY(max.y);
+
+			for (int y = Y0; y <= Y1; ++y)
+			{
+				// cells of a grid row are contiguous
+				const uint32_t BEGIN	= this->m_CellStart[y * GRID.m_CellsX + X0];
+				const uint32_t END		= this->m_CellStart[y * GRID.m_CellsX + X1 + 1];
+
+				for (uint32_t i = BEGIN; i < END; ++i)
+					visitor(this->m_Entries[i]);
+			}
+		}
+	};
+
+private:
+
+	// all bounty and collector game objects, inactive (dead) ones are skipped when the grids are build
+	GameObjectTracker	m_Bounty;
+	GameObjectTracker	m_Collector;
+
+	PerceptionGrid		m_BountyGrid;
+	PerceptionGrid		m_CollectorGrid;
+
+	void RegisterEventCallbacks();
+	void UnregisterEventCallbacks();
+
+	void OnGameObjectCreated(const GameObjectCreated* event);
+	void OnGameObjectDestroyed(const GameObjectDestroyed* event);
+
+	void BuildGrid(PerceptionGrid& grid, const GameObjectTracker& gameObjects);
+
+	void QueryBountyRadar(BountyRadar* radar);
+	void QueryCollectorAvoider(CollectorAvoider* avoider);
+
+public:
+
+	PerceptionSystem();
+	virtual ~PerceptionSystem();
+
+	virtual void PreUpdate(float dt) override;
+
+	void Reset();
+
+}; // class PerceptionSystem
+
+#endif // __PERCEPTION_SYSTEM_H__
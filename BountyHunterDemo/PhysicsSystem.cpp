@@ -5,6 +5,7 @@
 ///-------------------------------------------------------------------------------------------------
 
 #include "PhysicsSystem.h"
+#include "Profiler.h"
 #include "GameEvents.h"
 
 #include "Box2D/Box2D.h"
@@ -12,7 +13,9 @@
 #include "TransformComponent.h"
 #include "RigidbodyComponent.h"
 
-PhysicsSystem::PhysicsSystem()
+PhysicsSystem::PhysicsSystem() :
+	m_Bodies(ECS::ECS_Engine->GetComponentManager()),
+	m_AllTransformsChanged(true)
 {
 }
 
@@ -22,17 +25,43 @@ PhysicsSystem::~PhysicsSystem()
 
 void PhysicsSystem::PreUpdate(float dt)
 {
+	PROFILE_SCOPE("PhysicsSystem::PreUpdate");
+
+	// note: changes are listed over several ticks, if they are not cleared every tick (e.g. while rendering is skipped)
+	const size_t MAX_CHANGED_TRANSFORMS = this->m_Bodies.size();
+
 	// Sync physics rigidbody transformation and TransformComponent
-	for (auto RB = ECS::ECS_Engine->GetComponentManager()->begin<RigidbodyComponent>(); RB != ECS::ECS_Engine->GetComponentManager()->end<RigidbodyComponent>(); ++RB)
+	for (auto& it : this->m_Bodies)
 	{
-		if ((RB->m_Box2DBody->IsAwake() == true) && (RB->m_Box2DBody->IsActive() == true))
+		RigidbodyComponent& RB = it.Get<RigidbodyComponent>();
+
+		if ((RB.m_Box2DBody->IsAwake() == true) && (RB.m_Box2DBody->IsActive() == true))
 		{
-			TransformComponent* TFC = ECS::ECS_Engine->GetComponentManager()->GetComponent<TransformComponent>(RB->GetOwner());
+			const b2Vec2& pos = RB.m_Box2DBody->GetPosition();
+			const float   rot = RB.m_Box2DBody->GetAngle();
+
+			// skip bodies, which did not move since last sync
+			if (pos == RB.m_SyncedPosition && rot == RB.m_SyncedAngle)
+				continue;
+
+			TransformComponent& TFC = it.Get<TransformComponent>();
+			TFC.SetTransform2D(pos.x, pos.y, rot);
+
+			RB.m_SyncedPosition	= pos;
+			RB.m_SyncedAngle	= rot;
 
-			const b2Vec2& pos = RB->m_Box2DBody->GetPosition();
-			const float   rot = RB->m_Box2DBody->GetAngle();
-	
-			TFC->SetTransform(glm::translate(glm::mat4(1.0f), Position(pos.x, pos.y, 0.0f)) * glm::yawPitchRoll(0.0f, 0.0f, rot) * glm::scale(TFC->AsTransform()->GetScale()));
+			if (this->m_AllTransformsChanged == false)
+			{
+				if (this->m_ChangedTransforms.size() < MAX_CHANGED_TRANSFORMS)
+				{
+					this->m_ChangedTransforms.push_back(TFC.GetOwner());
+				}
+				else
+				{
+					this->m_ChangedTransforms.clear();
+					this->m_AllTransformsChanged = true;
+				}
+			}
 		}
 	}
 }
@@ -11,8 +11,30 @@
 
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 
+#include <vector>
+
+#include "GameTypes.h"
+
+class TransformComponent;
+class RigidbodyComponent;
+
 class PhysicsSystem : public ECS::System<PhysicsSystem>, public b2ContactListener
 {
+public:
+
+	using ChangedTransforms = std::vector<GameObjectId>;
+
+private:
+
+	// all bodies, which have a transform to sync
+	ECS::ComponentView<RigidbodyComponent, TransformComponent>	m_Bodies;
+
+	// owners of the transforms written since the changes were last cleared
+	ChangedTransforms	m_ChangedTransforms;
+
+	// set instead of listing more changes than there are bodies
+	bool				m_AllTransformsChanged;
+
 public:
 
 	PhysicsSystem();
@@ -26,6 +48,32 @@ public:
 	virtual void BeginContact(b2Contact* contact) override;
 	virtual void EndContact(b2Contact* contact) override;
 
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	inline const ChangedTransforms& PhysicsSystem::GetChangedTransforms() const
+	///
+	/// Summary:	Gets the owners of the transforms, which were updated from their rigidbody since
+	/// the last ClearChangedTransforms call, so the renderer only has to refresh those. Bodies that
+	/// did not move are not included. The list may contain game objects which are gone already and
+	/// is empty, if HaveAllTransformsChanged is true.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Returns:	The changed transforms.
+	///-------------------------------------------------------------------------------------------------
+
+	inline const ChangedTransforms& GetChangedTransforms() const { return this->m_ChangedTransforms; }
+
+	// true, if more transforms changed than could be listed, the consumer has to treat all of them as changed
+	inline bool HaveAllTransformsChanged() const { return this->m_AllTransformsChanged; }
+
+	inline void ClearChangedTransforms()
+	{
+		this->m_ChangedTransforms.clear();
+		this->m_AllTransformsChanged = false;
+	}
+
 }; // class PhysicsSystem
 
 #endif // __PHYSICS_SYSTEM_H__
\ No newline at end of file
@@ -0,0 +1,231 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	Profiler.cpp.
+///
+/// Summary:	Implements the frame profiler class.
+///-------------------------------------------------------------------------------------------------
+
+#include "Profiler.h"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <string.h>
+#include <stdio.h>
+
+Profiler g_Profiler;
+
+Profiler::Profiler() :
+	m_StartTime(Clock::now()),
+	m_InTick(false),
+	m_TickProbeTime(0.0f)
+{
+	this->m_TickProbe		= this->GetProbe("ECSEngine::Update");
+	this->m_TickSelfProbe	= this->GetProbe("ECSEngine::Update [events, entity clean-up]");
+}
+
+Profiler::~Profiler()
+{
+	this->m_Probes.clear();
+	this->m_TraceEvents.clear();
+	this->m_TraceThreads.clear();
+	this->m_Counters.clear();
+}
+
+Profiler::ProbeId Profiler::GetProbe(const char* name)
+{
+	std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+	for (ProbeId i = 0; i < this->m_Probes.size(); ++i)
+	{
+		if (strcmp(this->m_Probes[i].m_Name, name) == 0)
+			return i;
+	}
+
+	this->m_Probes.push_back(Probe(name));
+	return this->m_Probes.size() - 1;
+}
+
+void Profiler::AddSample(ProbeId probe, Clock::time_point begin, float ms, bool nested)
+{
+	std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+	Probe& P = this->m_Probes[probe];
+
+	// store sample in rolling window
+	if (P.m_Samples.size() < PROFILER_SAMPLE_WINDOW)
+		P.m_Samples.push_back(ms);
+	else
+		P.m_Samples[P.m_NextSample] = ms;
+
+	P.m_NextSample = (P.m_NextSample + 1) % PROFILER_SAMPLE_WINDOW;
+	P.m_TotalSamples++;
+
+	if (this->m_InTick == true && nested == false)
+		this->m_TickProbeTime += ms;
+
+	if (PROFILER_TRACE_FILE != nullptr)
+		this->AddTraceEvent(probe, begin, ms);
+}
+
+void Profiler::SetCounter(const char* name, size_t value)
+{
+	std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+	for (auto& counter : this->m_Counters)
+	{
+		if (strcmp(counter.m_Name, name) == 0)
+		{
+			counter.m_Value = value;
+			return;
+		}
+	}
+
+	this->m_Counters.push_back({ name, value });
+}
+
+void Profiler::AddTraceEvent(ProbeId probe, Clock::time_point begin, float ms)
+{
+	// stop recording, if trace is full
+	if (this->m_TraceEvents.size() >= PROFILER_MAX_TRACE_EVENTS)
+		return;
+
+	const std::thread::id THREAD = std::this_thread::get_id();
+
+	size_t thread = 0;
+	while (thread < this->m_TraceThreads.size() && this->m_TraceThreads[thread] != THREAD)
+		++thread;
+
+	if (thread == this->m_TraceThreads.size())
+		this->m_TraceThreads.push_back(THREAD);
+
+	TraceEvent event;
+	event.m_ProbeId		= probe;
+	event.m_Thread		= thread;
+	event.m_Begin		= std::chrono::duration<double, std::micro>(begin - this->m_StartTime).count();
+	event.m_Duration	= ms * 1000.0;
+
+	this->m_TraceEvents.push_back(event);
+}
+
+void Profiler::BeginTick()
+{
+	if (PROFILER_ENABLED == false)
+		return;
+
+	this->m_InTick				= true;
+	this->m_TickProbeTime		= 0.0f;
+	this->m_TickBegin			= Clock::now();
+	this->m_EngineUpdateBegin	= this->m_TickBegin;
+}
+
+void Profiler::BeginEngineUpdate()
+{
+	if (PROFILER_ENABLED == false)
+		return;
+
+	std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+	this->m_TickProbeTime		= 0.0f;
+	this->m_EngineUpdateBegin	= Clock::now();
+}
+
+void Profiler::EndTick()
+{
+	if (PROFILER_ENABLED == false)
+		return;
+
+	const Clock::time_point END = Clock::now();
+
+	const float TICK = std::chrono::duration<float, std::milli>(END - this->m_TickBegin).count();
+	const float ENGINE_UPDATE = std::chrono::duration<float, std::milli>(END - this->m_EngineUpdateBegin).count();
+
+	this->m_InTick = false;
+
+	this->AddSample(this->m_TickProbe, this->m_TickBegin, TICK);
+
+	// everything that was not sampled by a probe is spent inside the ECS itself
+	this->AddSample(this->m_TickSelfProbe, this->m_EngineUpdateBegin, std::max(0.0f, ENGINE_UPDATE - this->m_TickProbeTime), true);
+}
+
+Profiler::ProbeStats Profiler::GetProbeStats(ProbeId probe) const
+{
+	const Probe& P = this->m_Probes[probe];
+
+	ProbeStats stats { P.m_Samples.size(), 0.0f, 0.0f, 0.0f, 0.0f };
+	if (stats.m_SampleCount == 0)
+		return stats;
+
+	std::vector<float> sorted(P.m_Samples);
+	std::sort(sorted.begin(), sorted.end());
+
+	float sum = 0.0f;
+	for (auto sample : sorted)
+		sum += sample;
+
+	stats.m_Min = sorted.front();
+	stats.m_Max = sorted.back();
+	stats.m_Avg = sum / (float)stats.m_SampleCount;
+	stats.m_P99 = sorted[((stats.m_SampleCount - 1) * 99) / 100];
+
+	return stats;
+}
+
+void Profiler::PrintStats() const
+{
+	SDL_Log("***** PROFILER (last %zu samples, ms) *****\n", PROFILER_SAMPLE_WINDOW);
+	SDL_Log("%-48s %10s %10s %10s %10s\n", "Probe", "min", "avg", "p99", "max");
+	for (ProbeId i = 0; i < this->m_Probes.size(); ++i)
+	{
+		const ProbeStats stats = this->GetProbeStats(i);
+		if (stats.m_SampleCount == 0)
+			continue;
+
+		SDL_Log("%-48s %10.4f %10.4f %10.4f %10.4f\n", this->m_Probes[i].m_Name, stats.m_Min, stats.m_Avg, stats.m_P99, stats.m_Max);
+	}
+
+	for (auto& counter : this->m_Counters)
+		SDL_Log("%-48s %10zu\n", counter.m_Name, counter.m_Value);
+	SDL_Log("***** PROFILER *****\n");
+}
+
+bool Profiler::WriteCSV(const char* filename) const
+{
+	FILE* file = fopen(filename, "w");
+	if (file == nullptr)
+	{
+		SDL_LogError(SDL_LOG_PRIORITY_ERROR, "Failed to open profiler csv file '%s'!", filename);
+		return false;
+	}
+
+	fprintf(file, "probe,samples,total_samples,min_ms,avg_ms,p99_ms,max_ms\n");
+	for (ProbeId i = 0; i < this->m_Probes.size(); ++i)
+	{
+		const ProbeStats stats = this->GetProbeStats(i);
+		fprintf(file, "\"%s\",%zu,%zu,%f,%f,%f,%f\n", this->m_Probes[i].m_Name, stats.m_SampleCount, this->m_Probes[i].m_TotalSamples, stats.m_Min, stats.m_Avg, stats.m_P99, stats.m_Max);
+	}
+
+	fclose(file);
+	return true;
+}
+
+bool Profiler::WriteChromeTrace(const char* filename) const
+{
+	FILE* file = fopen(filename, "w");
+	if (file == nullptr)
+	{
+		SDL_LogError(SDL_LOG_PRIORITY_ERROR, "Failed to open profiler trace file '%s'!", filename);
+		return false;
+	}
+
+	// chrome://tracing 'complete' events
+	fprintf(file, "{\"traceEvents\":[\n");
+	for (size_t i = 0; i < this->m_TraceEvents.size(); ++i)
+	{
+		const TraceEvent& event = this->m_TraceEvents[i];
+		fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}\n", i > 0 ? "," : "", this->m_Probes[event.m_ProbeId].m_Name, event.m_Thread, event.m_Begin, event.m_Duration);
+	}
+	fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+
+	fclose(file);
+	return true;
+}
@@ -0,0 +1,274 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	Profiler.h.
+///
+/// Summary:	Declares the frame profiler class. The profiler collects timing samples of named
+/// probes (system update phases, physics sub-steps, ...) and keeps a rolling window of the last
+/// PROFILER_SAMPLE_WINDOW samples per probe, from which min/avg/p99/max statistics are computed.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <chrono>
+#include <vector>
+#include <mutex>
+#include <thread>
+
+#include "GameConfiguration.h"
+
+class Profiler
+{
+public:
+
+	using Clock			= std::chrono::steady_clock;
+	using ProbeId		= size_t;
+
+	struct ProbeStats
+	{
+		size_t	m_SampleCount;
+
+		float	m_Min;
+		float	m_Avg;
+		float	m_P99;
+		float	m_Max;
+
+	}; // struct ProbeStats
+
+private:
+
+	struct Probe
+	{
+		const char*			m_Name;
+
+		// rolling window of samples in milliseconds
+		std::vector<float>	m_Samples;
+		size_t				m_NextSample;
+
+		// total amount of samples ever taken
+		size_t				m_TotalSamples;
+
+		Probe(const char* name) :
+			m_Name(name),
+			m_NextSample(0),
+			m_TotalSamples(0)
+		{
+			this->m_Samples.reserve(PROFILER_SAMPLE_WINDOW);
+		}
+
+	}; // struct Probe
+
+	struct TraceEvent
+	{
+		ProbeId				m_ProbeId;
+
+		// index of the sampling thread in m_TraceThreads
+		size_t				m_Thread;
+
+		// begin and duration in microseconds since profiler start
+		double				m_Begin;
+		double				m_Duration;
+
+	}; // struct TraceEvent
+
+	struct Counter
+	{
+		const char*			m_Name;
+		size_t				m_Value;
+	}; // struct Counter
+
+	using Probes		= std::vector<Probe>;
+	using TraceEvents	= std::vector<TraceEvent>;
+	using TraceThreads	= std::vector<std::thread::id>;
+	using Counters		= std::vector<Counter>;
+
+
+	Clock::time_point	m_StartTime;
+
+	Probes				m_Probes;
+
+	TraceEvents			m_TraceEvents;
+
+	// threads, which have sampled trace events, a thread's index is its track in the trace
+	TraceThreads		m_TraceThreads;
+
+	// values reported along with the probes, e.g. memory high water marks
+	Counters			m_Counters;
+
+	// ECS tick measurement
+	ProbeId				m_TickProbe;
+	ProbeId				m_TickSelfProbe;
+	Clock::time_point	m_TickBegin;
+	Clock::time_point	m_EngineUpdateBegin;
+	bool				m_InTick;
+	float				m_TickProbeTime;
+
+	// probes are sampled concurrently, if systems are updated in parallel (see SYSTEM_WORKER_THREADS)
+	std::mutex			m_Mutex;
+
+	// note: expects m_Mutex to be locked
+	void AddTraceEvent(ProbeId probe, Clock::time_point begin, float ms);
+
+public:
+
+	Profiler();
+	~Profiler();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	ProbeId Profiler::GetProbe(const char* name);
+	///
+	/// Summary:	Gets the probe with the specified name, the probe is created, if it does not exist yet.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// name - 	The probe name. Must be a string literal or otherwise outlive the profiler.
+	///
+	/// Returns:	The probe id.
+	///-------------------------------------------------------------------------------------------------
+
+	ProbeId GetProbe(const char* name);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void Profiler::AddSample(ProbeId probe, Clock::time_point begin, float ms, bool nested = false);
+	///
+	/// Summary:	Adds a timing sample to a probe.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// probe - 	The probe.
+	/// begin - 	The point in time the measured section began.
+	/// ms - 		The measured time in milliseconds.
+	/// nested -	True, if the measured section is part of another sampled section (e.g. the
+	/// 			physics sub-steps of the world update). Nested samples are not accounted to the tick.
+	///-------------------------------------------------------------------------------------------------
+
+	void AddSample(ProbeId probe, Clock::time_point begin, float ms, bool nested = false);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void Profiler::BeginTick();
+	///
+	/// Summary:	Begins measuring an ECS tick. All probes sampled until EndTick() are accounted to this
+	/// tick, the remaining time of the tick (event dispatching, entity clean-up) is sampled separately.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void BeginTick();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void Profiler::BeginEngineUpdate();
+	///
+	/// Summary:	Marks the begin of ECSEngine::Update within the tick, after the systems were updated by
+	/// a SystemScheduler. Concurrent system probes overlap, so only the time from here on is used for
+	/// the remaining time of the tick.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void BeginEngineUpdate();
+
+	void EndTick();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	ProbeStats Profiler::GetProbeStats(ProbeId probe) const;
+	///
+	/// Summary:	Computes min/avg/p99/max of the probes current sample window.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// probe - 	The probe.
+	///
+	/// Returns:	The probe statistics.
+	///-------------------------------------------------------------------------------------------------
+
+	ProbeStats GetProbeStats(ProbeId probe) const;
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void Profiler::SetCounter(const char* name, size_t value);
+	///
+	/// Summary:	Sets the value of a counter, the counter is created, if it does not exist yet.
+	/// Counters are printed after the probe statistics.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// name - 		The counter name. Must be a string literal or otherwise outlive the profiler.
+	/// value - 	The value.
+	///-------------------------------------------------------------------------------------------------
+
+	void SetCounter(const char* name, size_t value);
+
+	void PrintStats() const;
+
+	bool WriteCSV(const char* filename) const;
+
+	bool WriteChromeTrace(const char* filename) const;
+
+}; // class Profiler
+
+// global profiler instance, defined in 'Profiler.cpp'
+extern Profiler g_Profiler;
+
+
+///-------------------------------------------------------------------------------------------------
+/// Class:	ProfileScope
+///
+/// Summary:	Samples the time from its construction to its destruction.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+class ProfileScope
+{
+private:
+
+	Profiler::ProbeId			m_Probe;
+	Profiler::Clock::time_point	m_Begin;
+	bool						m_Nested;
+
+public:
+
+	ProfileScope(Profiler::ProbeId probe, bool nested = false) :
+		m_Probe(probe),
+		m_Nested(nested)
+	{
+		if (PROFILER_ENABLED == true)
+			this->m_Begin = Profiler::Clock::now();
+	}
+
+	~ProfileScope()
+	{
+		if (PROFILER_ENABLED == true)
+			g_Profiler.AddSample(this->m_Probe, this->m_Begin, std::chrono::duration<float, std::milli>(Profiler::Clock::now() - this->m_Begin).count(), this->m_Nested);
+	}
+
+}; // class ProfileScope
+
+// Profiles the enclosing scope. Only one PROFILE_SCOPE per scope is allowed.
+#define PROFILE_SCOPE(name) \
+	static const Profiler::ProbeId PROFILE_PROBE_ID = g_Profiler.GetProbe(name); \
+	ProfileScope PROFILE_SCOPE_TIMER(PROFILE_PROBE_ID);
+
+// Profiles the enclosing scope, which is part of another profiled scope, so its time is not counted
+// twice into the tick.
+#define PROFILE_NESTED_SCOPE(name) \
+	static const Profiler::ProbeId PROFILE_PROBE_ID = g_Profiler.GetProbe(name); \
+	ProfileScope PROFILE_SCOPE_TIMER(PROFILE_PROBE_ID, true);
+
+#endif // __PROFILER_H__
@@ -5,6 +5,10 @@
 ///-------------------------------------------------------------------------------------------------
 
 #include "RenderSystem.h"
+#include "Profiler.h"
+#include "PhysicsSystem.h"
+
+#include <stddef.h>
 
 RenderSystem::RenderSystem(SDL_Window* window) :
 	m_Window(window),
@@ -21,6 +25,9 @@ RenderSystem::RenderSystem(SDL_Window* window) :
 	this->m_VertexBuffer = new VertexBuffer(GLOBAL_VERTEX_BUFFER_SIZE);
 	this->m_IndexBuffer = new IndexBuffer(GLOBAL_INDEX_BUFFER_SIZE);
 
+	// create camera uniform buffer
+	this->m_CameraUniformBuffer = new UniformBuffer(sizeof(CameraData));
+
 	RegisterEventCallbacks();
 }
 
@@ -35,11 +42,12 @@ RenderSystem::~RenderSystem()
 	}
 	this->m_BufferedShapes.clear();
 
-	for (auto it : this->m_RenderableGroups)
+	for (auto& it : this->m_RenderableGroups)
 	{		
-		it.first.Delete();
-		it.second.clear();
+		it.second.m_Group.Delete();
 	}
+	this->m_RenderableGroups.clear();
+	this->m_RenderableIndices.clear();
 	
 	// DEBUG DRAWING
 	delete this->m_DebugLineRenderer;
@@ -52,6 +60,9 @@ RenderSystem::~RenderSystem()
 	this->m_IndexBuffer = nullptr;
 	delete this->m_IndexBuffer;
 
+	delete this->m_CameraUniformBuffer;
+	this->m_CameraUniformBuffer = nullptr;
+
 
 	TerminateOpenGL();
 }
@@ -111,66 +122,90 @@ void RenderSystem::TerminateOpenGL()
 
 void RenderSystem::PreUpdate(float dt)
 {
+	PROFILE_SCOPE("RenderSystem::PreUpdate");
+
 	// Clear color and depth buffer
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
 void RenderSystem::Update(float dt)
 {
+	PROFILE_SCOPE("RenderSystem::Update");
+
 	if (this->m_ActiveCamera == nullptr)
 	{
 		SDL_LogError(SDL_LOG_PRIORITY_ERROR, "RenderSystem has no active camera!");
 		return;
 	}
 
+	UpdateModelTransforms();
+
+	// Upload active camera's view and projection matrix once for all materials
+	const glm::mat4& view		= this->m_ActiveCamera->GetViewTransform();
+	const glm::mat4& projection	= this->m_ActiveCamera->GetProjectionTransform();
+
+	const CameraData cameraData { view, projection, projection * view };
+
+	this->m_CameraUniformBuffer->BufferUniformData(&cameraData, sizeof(CameraData));
+	this->m_CameraUniformBuffer->BindBase(CAMERA_UNIFORM_BLOCK_BINDING);
+
 	MaterialID		lastUsedMaterial	= INVALID_MATERIAL_ID;
 	VertexArrayID	lastUsedVertexArray = -1;
 
-	for (auto& renderableGroup : this->m_RenderableGroups)
+	for (auto& it : this->m_RenderableGroups)
 	{
+		RenderableStore& renderables = it.second;
+		RenderableGroup& renderableGroup = renderables.m_Group;
+
 		// activate vertex array, if different from current bound
-		if (renderableGroup.first.m_VertexArray->GetID() != lastUsedVertexArray)
+		if (renderableGroup.m_VertexArray->GetID() != lastUsedVertexArray)
 		{
 			// restore vertex attribute bindings for this group
-			renderableGroup.first.m_VertexArray->Bind();
+			renderableGroup.m_VertexArray->Bind();
 
-			lastUsedVertexArray = renderableGroup.first.m_VertexArray->GetID();
+			lastUsedVertexArray = renderableGroup.m_VertexArray->GetID();
 		}
 
 		// activate material, if different from current used
-		if (renderableGroup.first.m_Material.GetMaterialID() != lastUsedMaterial)
+		if (renderableGroup.m_Material.GetMaterialID() != lastUsedMaterial)
 		{
-			renderableGroup.first.m_Material.Use();	
-
-			// Set active camera's view and projection matrix
-			((RenderableGroup)(renderableGroup.first)).m_Material.SetViewProjectionTransform(this->m_ActiveCamera->GetViewTransform(), this->m_ActiveCamera->GetProjectionTransform());
+			renderableGroup.m_Material.Use();	
 			
-			lastUsedMaterial = renderableGroup.first.m_Material.GetMaterialID();
+			lastUsedMaterial = renderableGroup.m_Material.GetMaterialID();
+		}
+
+		// render all renderables of current group with a single draw call
+		if (renderableGroup.m_InstanceBuffer != nullptr)
+		{
+			this->DrawInstanced(renderables);
+			continue;
 		}
 
 		// render all renderables of current group
-		for(auto renderable : renderableGroup.second)
+		for (size_t i = 0; i < renderables.size(); ++i)
 		{
-			// ignore disables renderables
-			if (renderable.m_GameObject->IsActive() == false && renderable.m_MaterialComponent->IsActive() == true && renderable.m_ShapeComponent->IsActive() == true)
+			if (renderables.IsRenderable(i) == false)
 				continue;
+
+			MaterialComponent*	material	= renderables.m_MaterialComponents[i];
+			ShapeComponent*		shape		= renderables.m_ShapeComponents[i];
 			
 			// apply material
-			renderable.m_MaterialComponent->Apply();
+			material->Apply();
 
 			// Set model transform uniform
-			renderable.m_MaterialComponent->SetModelTransform(renderable.m_TransformComponent->AsFloat());
+			material->SetModelTransform(&renderables.m_ModelTransforms[i][0][0]);
 
 			// draw shape
-			if (renderable.m_ShapeComponent->IsIndexed() == true)
+			if (shape->IsIndexed() == true)
 			{
 				// draw with indices
-				glDrawElements(GL_TRIANGLES, renderable.m_ShapeComponent->GetIndexCount(), VERTEX_INDEX_DATA_TYPE, BUFFER_OFFSET(renderable.m_ShapeComponent->GetIndexDataIndex()));
+				glDrawElements(GL_TRIANGLES, shape->GetIndexCount(), VERTEX_INDEX_DATA_TYPE, BUFFER_OFFSET(shape->GetIndexDataIndex()));
 			}
 			else
 			{
 				// draw without indices
-				glDrawArrays(GL_TRIANGLES, 0, renderable.m_ShapeComponent->GetTriangleCount());
+				glDrawArrays(GL_TRIANGLES, 0, shape->GetTriangleCount());
 			}
 		}	
 
@@ -185,12 +220,48 @@ void RenderSystem::Update(float dt)
 	if (DEBUG_DRAWING_ENABLED == true)
 	{
 		// render all lines
-		this->m_DebugLineRenderer->Flush(this->m_ActiveCamera->GetProjectionTransform(), this->m_DrawDebug);
+		this->m_DebugLineRenderer->Flush(this->m_DrawDebug);
+	}
+}
+
+void RenderSystem::DrawInstanced(const RenderableStore& renderables)
+{
+	this->m_InstanceData.clear();
+
+	for (size_t i = 0; i < renderables.size(); ++i)
+	{
+		if (renderables.IsRenderable(i) == false)
+			continue;
+
+		this->m_InstanceData.push_back({ renderables.m_ModelTransforms[i], renderables.m_MaterialComponents[i]->GetColor() });
+	}
+
+	if (this->m_InstanceData.empty() == true)
+		return;
+
+	// all renderables of a group share the same shape
+	const ShapeComponent* shape = renderables.m_ShapeComponents[0];
+
+	// upload per instance attributes
+	renderables.m_Group.m_InstanceBuffer->BufferInstanceData(this->m_InstanceData.data(), this->m_InstanceData.size() * sizeof(InstanceData));
+
+	// draw shape
+	if (shape->IsIndexed() == true)
+	{
+		// draw with indices
+		glDrawElementsInstanced(GL_TRIANGLES, shape->GetIndexCount(), VERTEX_INDEX_DATA_TYPE, BUFFER_OFFSET(shape->GetIndexDataIndex()), (GLsizei)this->m_InstanceData.size());
+	}
+	else
+	{
+		// draw without indices
+		glDrawArraysInstanced(GL_TRIANGLES, 0, shape->GetTriangleCount(), (GLsizei)this->m_InstanceData.size());
 	}
 }
 
 void RenderSystem::PostUpdate(float dt)
 {
+	PROFILE_SCOPE("RenderSystem::PostUpdate");
+
 	// Swap Buffers and bring new rendered OpenGL content to the front
 	SDL_GL_SwapWindow(this->m_Window);
 
@@ -198,6 +269,12 @@ void RenderSystem::PostUpdate(float dt)
 	glGetLastError();
 }
 
+void RenderSystem::SetVSync(bool enabled)
+{
+	if (SDL_GL_SetSwapInterval(enabled == true ? 1 : 0) != 0)
+		SDL_LogWarn(SDL_LOG_PRIORITY_WARN, "Failed to change swap interval! %s", SDL_GetError());
+}
+
 void RenderSystem::SetShapeBufferIndex(ShapeComponent* shapeComponent)
 {
 	assert(shapeComponent->GetShapeID() != IShape::INVALID_SHAPE && "RenderSystem got Entity with invalid shape.");
@@ -262,14 +339,12 @@ void RenderSystem::RegisterRenderable(ECS::IEntity* entity, TransformComponent*
 	const RenderableGroupID RGID = CreateRenderableGroupID(material, shape);
 
 	// check if there is already a group for this renderable
-	for (auto it : this->m_RenderableGroups)
+	RenderableGroups::iterator it = this->m_RenderableGroups.find(RGID);
+	if (it != this->m_RenderableGroups.end())
 	{
-		if (it.first.m_GroupID == RGID)
-		{
-			// place renderable in this group
-			this->m_RenderableGroups[RGID].push_back(Renderable(entity, transform, material, shape));
-			return;
-		}
+		// place renderable in this group
+		this->IndexRenderable(entity->GetEntityID(), &it->second, it->second.Add(entity, transform, material, shape));
+		return;
 	}
 	
 	// There is no group for this renderable yet, create a new one
@@ -317,28 +392,107 @@ void RenderSystem::RegisterRenderable(ECS::IEntity* entity, TransformComponent*
 				glEnableVertexAttribArray(colorVertexAttribute);
 				glVertexAttribPointer(colorVertexAttribute, VERTEX_COLOR_DATA_ELEMENT_LEN, VERTEX_COLOR_DATA_TYPE, GL_FALSE, 0, BUFFER_OFFSET(shape->GetColorDataIndex()));
 			}
+
+			// per instance model transform and color
+			if (renderableGroup.m_InstanceBuffer != nullptr)
+			{
+				renderableGroup.m_InstanceBuffer->Bind();
+
+				// a mat4 attribute is made of 4 vec4 attributes
+				MaterialVertexAttributeLoc modelTransformAttribute = material->GetInstanceModelTransformVertexAttributeLocation();
+				for (MaterialVertexAttributeLoc i = 0; i < 4; ++i)
+				{
+					glEnableVertexAttribArray(modelTransformAttribute + i);
+					glVertexAttribPointer(modelTransformAttribute + i, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), BUFFER_OFFSET(offsetof(InstanceData, m_ModelTransform) + i * sizeof(glm::vec4)));
+					glVertexAttribDivisor(modelTransformAttribute + i, 1);
+				}
+
+				MaterialVertexAttributeLoc colorAttribute = material->GetInstanceColorVertexAttributeLocation();
+				glEnableVertexAttribArray(colorAttribute);
+				glVertexAttribPointer(colorAttribute, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), BUFFER_OFFSET(offsetof(InstanceData, m_Color0)));
+				glVertexAttribDivisor(colorAttribute, 1);
+			}
 		}
 		renderableGroup.m_VertexArray->Unbind();
 
 		this->m_VertexBuffer->Unbind();
 		this->m_IndexBuffer->Unbind();
 	}
-	this->m_RenderableGroups[renderableGroup].push_back(Renderable(entity, transform, material, shape));
+
+	RenderableStore* renderables = &this->m_RenderableGroups.emplace(RGID, RenderableStore(renderableGroup)).first->second;
+	this->IndexRenderable(entity->GetEntityID(), renderables, renderables->Add(entity, transform, material, shape));
 }
 
 void RenderSystem::UnregisterRenderable(GameObjectId gameObjectId)
 {
-	for (auto& RG : this->m_RenderableGroups)
+	if (gameObjectId.index >= this->m_RenderableIndices.size())
+		return;
+
+	RenderableIndex& renderableIndex = this->m_RenderableIndices[gameObjectId.index];
+
+	RenderableStore* renderables = renderableIndex.m_Store;
+	const size_t INDEX = renderableIndex.m_Index;
+
+	// not registered
+	if (renderables == nullptr || renderables->m_GameObjectIds[INDEX] != gameObjectId)
+		return;
+
+	renderables->Remove(INDEX);
+	renderableIndex = { nullptr, 0 };
+
+	// update index of the renderable that was moved into the gap
+	if (INDEX < renderables->size())
+		this->IndexRenderable(renderables->m_GameObjectIds[INDEX], renderables, INDEX);
+}
+
+void RenderSystem::IndexRenderable(GameObjectId gameObjectId, RenderableStore* renderables, size_t index)
+{
+	if (gameObjectId.index >= this->m_RenderableIndices.size())
+		this->m_RenderableIndices.resize(gameObjectId.index + 1, { nullptr, 0 });
+
+	this->m_RenderableIndices[gameObjectId.index] = { renderables, index };
+}
+
+void RenderSystem::RefreshModelTransform(GameObjectId gameObjectId)
+{
+	if (gameObjectId.index >= this->m_RenderableIndices.size())
+		return;
+
+	const RenderableIndex& renderableIndex = this->m_RenderableIndices[gameObjectId.index];
+
+	RenderableStore* renderables = renderableIndex.m_Store;
+	const size_t INDEX = renderableIndex.m_Index;
+
+	// not registered (anymore)
+	if (renderables == nullptr || renderables->m_GameObjectIds[INDEX] != gameObjectId)
+		return;
+
+	renderables->m_ModelTransforms[INDEX] = renderables->m_TransformComponents[INDEX]->AsTransform2D()->AsMat4();
+}
+
+void RenderSystem::UpdateModelTransforms()
+{
+	PhysicsSystem* PS = ECS::ECS_Engine->GetSystemManager()->GetSystem<PhysicsSystem>();
+	if (PS == nullptr)
+		return;
+
+	if (PS->HaveAllTransformsChanged() == true)
 	{
-		for (RenderableList::iterator it = RG.second.begin(); it != RG.second.end(); ++it)
+		for (auto& it : this->m_RenderableGroups)
 		{
-			if (it->m_GameObject->GetEntityID() == gameObjectId)
-			{
-				RG.second.erase(it);
-				return;
-			}
+			RenderableStore& renderables = it.second;
+
+			for (size_t i = 0; i < renderables.size(); ++i)
+				renderables.m_ModelTransforms[i] = renderables.m_TransformComponents[i]->AsTransform2D()->AsMat4();
 		}
 	}
+	else
+	{
+		for (auto gameObjectId : PS->GetChangedTransforms())
+			RefreshModelTransform(gameObjectId);
+	}
+
+	PS->ClearChangedTransforms();
 }
 
 void RenderSystem::RegisterEventCallbacks()
@@ -349,6 +503,7 @@ void RenderSystem::RegisterEventCallbacks()
 
 	RegisterEventCallback(&RenderSystem::OnGameObjectCreated);
 	RegisterEventCallback(&RenderSystem::OnGameObjectDestroyed);
+	RegisterEventCallback(&RenderSystem::OnGameObjectSpawned);
 
 	RegisterEventCallback(&RenderSystem::OnCameraCreated);
 	RegisterEventCallback(&RenderSystem::OnCameraDestroyed);
@@ -364,6 +519,7 @@ void RenderSystem::UnregisterEventCallbacks()
 
 	UnregisterEventCallback(&RenderSystem::OnGameObjectCreated);
 	UnregisterEventCallback(&RenderSystem::OnGameObjectDestroyed);
+	UnregisterEventCallback(&RenderSystem::OnGameObjectSpawned);
 
 	UnregisterEventCallback(&RenderSystem::OnCameraCreated);
 	UnregisterEventCallback(&RenderSystem::OnCameraDestroyed);
@@ -414,6 +570,12 @@ void RenderSystem::OnGameObjectDestroyed(const GameObjectDestroyed* event)
 	UnregisterRenderable(event->m_EntityID);
 }
 
+void RenderSystem::OnGameObjectSpawned(const GameObjectSpawned* event)
+{
+	// spawned game objects are placed without physics, which would not report the change
+	RefreshModelTransform(event->m_EntityID);
+}
+
 void RenderSystem::OnCameraCreated(const CameraCreated* event)
 {
 	if (this->m_ActiveCamera == nullptr)
@@ -457,7 +619,8 @@ void RenderSystem::OnToggleDebugDraw(const ToggleDebugDrawEvent * event)
 
 void RenderSystem::DrawLine(Position2D p0, Position2D p1, bool arrowHead0, bool arrowHead1, Color3f color)
 {
-	if (DEBUG_DRAWING_ENABLED == true)
+	// note: while disabled (ticks that are not rendered) the lines would never be flushed, but pile up until the line buffer is full
+	if (DEBUG_DRAWING_ENABLED == true && ECS::ECS_Engine->GetSystemManager()->IsSystemEnabled<RenderSystem>() == true)
 	{
 		this->m_DebugLineRenderer->AddLine(Position(p0, -1.0f), Position(p1, -1.0f), color);
 
@@ -13,7 +13,7 @@
 #include <SDL.h>
 
 #include <unordered_map>
-#include <list>
+#include <vector>
 
 #include "GLBuffer.h"
 #include "GLShader.h"
@@ -45,36 +45,104 @@ class RenderSystem : public ECS::System<RenderSystem>, protected ECS::Event::IEv
 	using BufferedShapes = std::vector<ShapeBufferIndex*>;
 
 
-	struct Renderable
+	///-------------------------------------------------------------------------------------------------
+	/// Struct:	RenderableStore
+	///
+	/// Summary:	Packed structure-of-arrays storage of all renderables of a renderable group. The
+	/// i-th element of each array belongs to the same renderable. Removal swaps the last renderable
+	/// into the gap, so the arrays stay dense.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	struct RenderableStore
 	{
-		GameObjectId			m_GameObjectId;
-		ECS::IEntity*			m_GameObject;
-		
-		TransformComponent*		m_TransformComponent;
-		ShapeComponent*			m_ShapeComponent;
-		MaterialComponent*		m_MaterialComponent;
-		
-
-		Renderable(ECS::IEntity* entity, TransformComponent* transform, MaterialComponent* material, ShapeComponent* shape) :
-			m_GameObjectId(entity->GetEntityID()),
-			m_GameObject(entity),
-			m_TransformComponent(transform),
-			m_MaterialComponent(material),
-			m_ShapeComponent(shape)
+		RenderableGroup						m_Group;
+
+		std::vector<GameObjectId>			m_GameObjectIds;
+		std::vector<ECS::IEntity*>			m_GameObjects;
+		std::vector<TransformComponent*>	m_TransformComponents;
+		std::vector<MaterialComponent*>		m_MaterialComponents;
+		std::vector<ShapeComponent*>		m_ShapeComponents;
+
+		// model transform of each renderable, refreshed when its transform changed
+		std::vector<glm::mat4>				m_ModelTransforms;
+
+		RenderableStore(const RenderableGroup& group) :
+			m_Group(group)
 		{}
 
-		~Renderable()
+		inline size_t size() const { return this->m_GameObjectIds.size(); }
+
+		// adds a renderable and returns its index
+		size_t Add(ECS::IEntity* entity, TransformComponent* transform, MaterialComponent* material, ShapeComponent* shape)
+		{
+			this->m_GameObjectIds.push_back(entity->GetEntityID());
+			this->m_GameObjects.push_back(entity);
+			this->m_TransformComponents.push_back(transform);
+			this->m_MaterialComponents.push_back(material);
+			this->m_ShapeComponents.push_back(shape);
+			this->m_ModelTransforms.push_back(transform->AsTransform2D()->AsMat4());
+
+			return this->m_GameObjectIds.size() - 1;
+		}
+
+		// removes the renderable at 'index' by moving the last renderable in its place
+		void Remove(size_t index)
 		{
-			this->m_GameObjectId = INVALID_GAMEOBJECT_ID;
-			this->m_GameObject = nullptr;
-			this->m_TransformComponent = nullptr;
-			this->m_MaterialComponent = nullptr;
-			this->m_ShapeComponent = nullptr;
+			const size_t LAST = this->m_GameObjectIds.size() - 1;
+
+			this->m_GameObjectIds[index]		= this->m_GameObjectIds[LAST];
+			this->m_GameObjects[index]			= this->m_GameObjects[LAST];
+			this->m_TransformComponents[index]	= this->m_TransformComponents[LAST];
+			this->m_MaterialComponents[index]	= this->m_MaterialComponents[LAST];
+			this->m_ShapeComponents[index]		= this->m_ShapeComponents[LAST];
+			this->m_ModelTransforms[index]		= this->m_ModelTransforms[LAST];
+
+			this->m_GameObjectIds.pop_back();
+			this->m_GameObjects.pop_back();
+			this->m_TransformComponents.pop_back();
+			this->m_MaterialComponents.pop_back();
+			this->m_ShapeComponents.pop_back();
+			this->m_ModelTransforms.pop_back();
 		}
+
+		// ignore disabled renderables
+		inline bool IsRenderable(size_t index) const
+		{
+			return !(this->m_GameObjects[index]->IsActive() == false && this->m_MaterialComponents[index]->IsActive() == true && this->m_ShapeComponents[index]->IsActive() == true);
+		}
+	};
+
+	using RenderableGroups = std::unordered_map<RenderableGroupID, RenderableStore>;
+
+	// location of a registered renderable, indexed by its game object's handle index
+	struct RenderableIndex
+	{
+		RenderableStore*	m_Store;
+		size_t				m_Index;
 	};
 
-	using RenderableList = std::list<Renderable>;
-	using RenderableGroups = std::unordered_map<RenderableGroup, RenderableList>;
+	using RenderableIndexMap = std::vector<RenderableIndex>;
+
+	// per instance attributes of an instanced renderable
+	struct InstanceData
+	{
+		glm::mat4				m_ModelTransform;
+		Color4f					m_Color0;
+	};
+
+	using InstanceDataList = std::vector<InstanceData>;
+
+	// per frame camera data, std140 layout of the camera uniform block (see SHADER_DEFINE_CAMERA_UNIFORM_BLOCK)
+	struct CameraData
+	{
+		glm::mat4				m_ViewTransform;
+		glm::mat4				m_ProjectionTransform;
+		glm::mat4				m_ViewProjectionTransform;
+	};
 
 
 
@@ -90,12 +158,21 @@ private:
 	VertexBuffer*		m_VertexBuffer;
 	IndexBuffer*		m_IndexBuffer;
 
+	// Per frame camera data shared by all materials
+	UniformBuffer*		m_CameraUniformBuffer;
+
 	// Keeps track of already buffered shapes
 	BufferedShapes		m_BufferedShapes;
 
 	// A set of all currently registered randerable entities
 	RenderableGroups	m_RenderableGroups;
 
+	// Maps game objects to their renderable location, for O(1) removal
+	RenderableIndexMap	m_RenderableIndices;
+
+	// Instance data of the currently rendered group
+	InstanceDataList	m_InstanceData;
+
 	// Active Camera
 	IGameCamera*		m_ActiveCamera;
 
@@ -128,8 +205,44 @@ private:
 	void SetShapeBufferIndex(ShapeComponent* shapeComponent);
 
 	void RegisterRenderable(ECS::IEntity* entity, TransformComponent* transform, MaterialComponent* material, ShapeComponent* shape);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:
+	/// void RenderSystem::DrawInstanced(const RenderableStore& renderables);
+	///
+	/// Summary:	Draws all renderables of an instanced renderable group with a single draw call.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// renderables - 	The renderable group and its renderables.
+	///-------------------------------------------------------------------------------------------------
+
+	void DrawInstanced(const RenderableStore& renderables);
 	void UnregisterRenderable(GameObjectId gameObjectId);
 
+	// stores the location of a game object's renderable
+	void IndexRenderable(GameObjectId gameObjectId, RenderableStore* renderables, size_t index);
+
+	// recomputes the model transform of a game object's renderable, if it has one
+	void RefreshModelTransform(GameObjectId gameObjectId);
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void RenderSystem::UpdateModelTransforms();
+	///
+	/// Summary:	Recomputes the model transforms of the renderables, whose transforms the physics
+	/// system has changed since the last rendered frame. Static and sleeping renderables keep their
+	/// model transform.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void UpdateModelTransforms();
+
 	// Event callbacks
 	void OnWindowResized(const WindowResizedEvent* event);
 	void OnWindowMinimized(const WindowMinimizedEvent* event);
@@ -137,6 +250,7 @@ private:
 
 	void OnGameObjectCreated(const GameObjectCreated* event);
 	void OnGameObjectDestroyed(const GameObjectDestroyed* event);
+	void OnGameObjectSpawned(const GameObjectSpawned* event);
 
 	void OnCameraCreated(const CameraCreated* event);
 	void OnCameraDestroyed(const CameraDestroyed* event);
@@ -152,6 +266,21 @@ public:
 	virtual void Update(float dt) override;
 	virtual void PostUpdate(float dt) override;
 
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void RenderSystem::SetVSync(bool enabled);
+	///
+	/// Summary:	Enables or disables synchronization of buffer swaps with the monitor refresh rate.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// enabled - 	True to enable vsync.
+	///-------------------------------------------------------------------------------------------------
+
+	void SetVSync(bool enabled);
+
 	///-------------------------------------------------------------------------------------------------
 	/// Fn:
 	/// void RenderSystem::DrawLine(Position2D p0, Position2D p1, Color3f color0 = Color3f(1.0f),
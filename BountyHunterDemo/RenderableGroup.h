@@ -10,38 +10,46 @@
 #include "Material.h"
 
 struct VertexArray;
+struct InstanceBuffer;
 
 
 using RenderableGroupID = uint32_t;
 
+/// Summary:	Initial size of a renderable groups instance buffer, it will grow if needed.
+static constexpr size_t INITIAL_INSTANCE_BUFFER_SIZE { 65536 /* 64 KB */ };
 
 
 /// Summary:
 /// A render group is a set of renderables that share common properties like the same shader and shape.
 /// A RenderableGroup has an ID that is the product of the merged ShapeID and MaterialID of a renderable.
-/// It also has an Vertex Array Object holding the appropriate OpenGL state. 
+/// It also has an Vertex Array Object holding the appropriate OpenGL state. If the groups material
+/// is instanced, the group also owns a buffer with the per instance attributes of all its renderables.
 struct RenderableGroup
 {
 	const RenderableGroupID		m_GroupID;
 	const VertexArray*			m_VertexArray;
+	InstanceBuffer*				m_InstanceBuffer;
 	
 	Material					m_Material;
 
 	RenderableGroup(const RenderableGroupID groupID) :
 		m_GroupID(groupID),
 		m_VertexArray(new VertexArray),
+		m_InstanceBuffer(nullptr),
 		m_Material(nullptr)
 	{}
 
 	RenderableGroup(const RenderableGroupID groupID, Material material) :
 		m_GroupID(groupID),
 		m_VertexArray(new VertexArray),
+		m_InstanceBuffer(material.IsInstanced() ? new InstanceBuffer(INITIAL_INSTANCE_BUFFER_SIZE) : nullptr),
 		m_Material(material)
 	{}
 
 	void Delete() const
 	{
 		delete this->m_VertexArray;
+		delete this->m_InstanceBuffer;
 	}
 
 	bool operator==(const RenderableGroup &other) const
@@ -1,9 +1,15 @@
 #include "RespawnSystem.h"
+#include "Profiler.h"
 #include "WorldSystem.h"
+#include "TransformComponent.h"
 
 RespawnSystem::RespawnSystem() :
 	m_Spawns(1024, INVALID_GAMEOBJECT_ID)
 {
+	// spawns are queued in the world system, so respawn system may be updated concurrently with other systems
+	ReadsComponents<TransformComponent>();
+	WritesSystems<WorldSystem>();
+
 	RegisterEventCallbacks();
 }
 
@@ -14,6 +20,8 @@ RespawnSystem::~RespawnSystem()
 
 void RespawnSystem::Update(float dt)
 {
+	PROFILE_SCOPE("RespawnSystem::Update");
+
 	auto s = this->m_RespawnQueue.begin();
 	while (s != this->m_RespawnQueue.end())
 	{
@@ -56,9 +64,9 @@ void RespawnSystem::Update(float dt)
 			assert(spawnInfo.m_SpawnPosition != INVALID_POSITION && "Failed to respawn game object!");
 			
 			// maintain old game object scale
-			glm::vec3 oldScale = ECS::ECS_Engine->GetComponentManager()->GetComponent<TransformComponent>(s->m_spawnableID)->AsTransform()->GetScale();
+			glm::vec2 oldScale = ECS::ECS_Engine->GetComponentManager()->GetComponent<TransformComponent>(s->m_spawnableID)->GetScale();
 
-			Transform transform = glm::translate(glm::mat4(1.0f), spawnInfo.m_SpawnPosition) * glm::yawPitchRoll(spawnInfo.m_SpawnOrientation[0], spawnInfo.m_SpawnOrientation[1], spawnInfo.m_SpawnOrientation[2]) * glm::scale(oldScale);
+			Transform transform = glm::translate(glm::mat4(1.0f), spawnInfo.m_SpawnPosition) * glm::yawPitchRoll(spawnInfo.m_SpawnOrientation[0], spawnInfo.m_SpawnOrientation[1], spawnInfo.m_SpawnOrientation[2]) * glm::scale(glm::vec3(oldScale, 1.0f));
 
 			// spawn object
 			ECS::ECS_Engine->GetSystemManager()->GetSystem<WorldSystem>()->SpawnGameObject(s->m_spawnableID, transform);
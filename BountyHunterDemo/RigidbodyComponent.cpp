@@ -17,7 +17,9 @@ RigidbodyComponent::RigidbodyComponent() :
 	m_Restitution(0.0f),
 	m_LinearDamping(0.0f),
 	m_AngularDamping(0.0f),
-	m_Density(1.0f)
+	m_Density(1.0f),
+	m_SyncedPosition(0.0f, 0.0f),
+	m_SyncedAngle(NAN)
 {
 }
 
@@ -28,7 +30,9 @@ RigidbodyComponent::RigidbodyComponent(float friction, float restitution, float
 	m_Restitution(restitution),
 	m_LinearDamping(linearDamping),
 	m_AngularDamping(angularDamping),
-	m_Density(density)
+	m_Density(density),
+	m_SyncedPosition(0.0f, 0.0f),
+	m_SyncedAngle(NAN)
 {
 }
 
@@ -36,11 +40,10 @@ RigidbodyComponent::~RigidbodyComponent()
 {
 }
 
-void RigidbodyComponent::SetTransform(const Transform& transform)
+void RigidbodyComponent::SetTransform(const Transform2D& transform)
 {
-	Position2D pos = transform.GetPosition();
-	float angle = transform.GetRotation().z;
-	this->m_Box2DBody->SetTransform(b2Vec2(pos.x, pos.y), angle);
+	const Position2D& pos = transform.GetPosition();
+	this->m_Box2DBody->SetTransform(b2Vec2(pos.x, pos.y), transform.GetAngle());
 }
 
 void RigidbodyComponent::SetScale(const glm::vec2 & scale)
@@ -9,7 +9,7 @@
 
 #include <ECS/ECS.h>
 
-#include "Transform.h"
+#include "Transform2D.h"
 
 #include "Box2D/Dynamics/b2Body.h"
 
@@ -28,11 +28,16 @@ public:
 	/// Summary:	The box2D physics body object. This member will be set by World2D class.
 	b2Body*		m_Box2DBody;
 
+	/// Summary:	Body position and angle last written to the TransformComponent by the PhysicsSystem.
+	/// The angle is NAN until the first sync.
+	b2Vec2		m_SyncedPosition;
+	float		m_SyncedAngle;
+
 	RigidbodyComponent();
 	RigidbodyComponent(float friction, float restitution, float linearDamping, float angularDamping, float density);
 	virtual ~RigidbodyComponent();
 
-	void SetTransform(const Transform& transform);
+	void SetTransform(const Transform2D& transform);
 
 	void SetScale(const glm::vec2& scale);
 
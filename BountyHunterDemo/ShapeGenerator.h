@@ -11,6 +11,8 @@
 #include "Shape.h"
 
 #include <vector>
+#include <assert.h>
+#include <stdio.h>
 
 class Shape;
 
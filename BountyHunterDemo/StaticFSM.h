@@ -0,0 +1,374 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	StaticFSM.h.
+///
+/// Summary:	Declares the static finite state machine a class can derive from. The deriving class is
+/// the context and a state is expressed by its member functions. States are values of an enum and
+/// all tables are built at compile time: a state table with the
+/// update, onEnter and onLeave procedure of each state and a [from][to] transition matrix. Changing
+/// state is a constant time lookup and the state stack is stored inline, so the FSM never allocates.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __STATIC_FSM_H__
+#define __STATIC_FSM_H__
+
+#include <stddef.h>
+#include <assert.h>
+
+///-------------------------------------------------------------------------------------------------
+/// Def:	BEGIN_FSM_STATE_TABLE
+///
+/// Summary:	A macro that defines the begining of the state table. Only use that one once! Add a
+/// FSM_STATE entry for every state between BEGIN_FSM_STATE_TABLE and END_FSM_STATE_TABLE.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+#define BEGIN_FSM_STATE_TABLE																									\
+	friend StaticFSM;																											\
+																																\
+	static const StateTable& GetStateTable()																					\
+	{																															\
+		static constexpr StateEntry STATE_TABLE[] =																				\
+		{																														\
+
+///-------------------------------------------------------------------------------------------------
+/// Def:	FSM_STATE(state, onUpdate, onEnter, onLeave)
+///
+/// Summary:	A macro that defines a state table entry. 'onUpdate' is executed by UpdateStateMachine
+/// while 'state' is active, 'onEnter' when changing to 'state' and 'onLeave' when changing from
+/// 'state' to another state. Procedures are given as member function pointers, use NO_STATE_PROC if a
+/// state has no such procedure.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+#define FSM_STATE(state, onUpdate, onEnter, onLeave)																			\
+			{ state, onUpdate, onEnter, onLeave },																				\
+
+#define END_FSM_STATE_TABLE																										\
+		};																														\
+																																\
+		static constexpr StateTable TABLE = StateTable::Build(STATE_TABLE);														\
+		return TABLE;																											\
+	}
+
+///-------------------------------------------------------------------------------------------------
+/// Def:	BEGIN_FSM_TRANSITION_TABLE
+///
+/// Summary:	A macro that defines the begining of the transition table. Only use that one once! Add a
+/// FSM_TRANSITION entry for every allowed transition and one FSM_INITIAL_TRANSITION for the state
+/// the FSM may start in between BEGIN_FSM_TRANSITION_TABLE and END_FSM_TRANSITION_TABLE.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+#define BEGIN_FSM_TRANSITION_TABLE																								\
+	static const TransitionMatrix& GetTransitionMatrix()																		\
+	{																															\
+		static constexpr TransitionEntry TRANSITION_TABLE[] =																	\
+		{																														\
+
+#define FSM_INITIAL_TRANSITION(to)																								\
+			{ NullState(), to },																								\
+
+#define FSM_TRANSITION(from, to)																								\
+			{ from, to },																										\
+
+#define END_FSM_TRANSITION_TABLE																								\
+		};																														\
+																																\
+		static constexpr TransitionMatrix MATRIX = TransitionMatrix::Build(TRANSITION_TABLE);									\
+		return MATRIX;																											\
+	}
+
+#define NO_STATE_PROC nullptr
+
+
+///-------------------------------------------------------------------------------------------------
+/// Class:	StaticFSM
+///
+/// Summary:	Static finite state machine. The deriving class defines its states with
+/// BEGIN_FSM_STATE_TABLE and its transitions with BEGIN_FSM_TRANSITION_TABLE.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///
+/// Typeparams:
+/// T - 						The deriving class.
+/// S - 						The state enum, values must be 0 to NUM_STATES - 1.
+/// NUM_STATES - 				Number of states.
+/// MAX_STATE_STACK_SIZE - 	Capacity of the state stack (PushState).
+///-------------------------------------------------------------------------------------------------
+
+template<class T, class S, size_t NUM_STATES, size_t MAX_STATE_STACK_SIZE = 4>
+class StaticFSM
+{
+public:
+
+	using StateProc = void (T::*)();
+
+	struct StateEntry
+	{
+		S			state;
+
+		StateProc	onUpdate;
+		StateProc	onEnter;
+		StateProc	onLeave;
+	};
+
+	struct TransitionEntry
+	{
+		S			from;
+		S			to;
+	};
+
+	struct StateTable
+	{
+		// indexed by state
+		StateEntry	m_States[NUM_STATES];
+
+		template<size_t N>
+		static constexpr StateTable Build(const StateEntry (&entries)[N])
+		{
+			StateTable table {};
+
+			for (size_t i = 0; i < N; ++i)
+				table.m_States[(size_t)entries[i].state] = entries[i];
+
+			return table;
+		}
+	};
+
+	struct TransitionMatrix
+	{
+		// [from][to], row NUM_STATES holds the initial transitions (from null state)
+		bool		m_Allowed[NUM_STATES + 1][NUM_STATES];
+
+		template<size_t N>
+		static constexpr TransitionMatrix Build(const TransitionEntry (&entries)[N])
+		{
+			TransitionMatrix matrix {};
+
+			for (size_t i = 0; i < N; ++i)
+				matrix.m_Allowed[(size_t)entries[i].from][(size_t)entries[i].to] = true;
+
+			return matrix;
+		}
+	};
+
+	// state of a FSM, which has not been started or was reset
+	static constexpr S NullState() { return (S)NUM_STATES; }
+
+private:
+
+	S				m_StateStack[MAX_STATE_STACK_SIZE];
+	size_t			m_StateStackSize;
+
+	S				m_ActiveState;
+
+	inline void CallStateProc(StateProc proc)
+	{
+		if (proc != nullptr)
+			(static_cast<T*>(this)->*proc)();
+	}
+
+	inline bool IsTransitionAllowed(S from, S to) const
+	{
+		return T::GetTransitionMatrix().m_Allowed[(size_t)from][(size_t)to];
+	}
+
+	// runs the onLeave proc of the active state and the onEnter proc of state, which becomes active
+	void EnterState(S state)
+	{
+		const StateTable& states = T::GetStateTable();
+
+		// onLeave proc
+		if (this->m_ActiveState != NullState())
+			CallStateProc(states.m_States[(size_t)this->m_ActiveState].onLeave);
+
+		// onEnter proc
+		CallStateProc(states.m_States[(size_t)state].onEnter);
+
+		this->m_ActiveState = state;
+	}
+
+public:
+
+	StaticFSM() :
+		m_StateStackSize(0),
+		m_ActiveState(NullState())
+	{}
+
+	~StaticFSM()
+	{}
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	inline S StaticFSM::GetActiveState() const
+	///
+	/// Summary:	Gets the state on top of the state stack, NullState() if the stack is empty.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Returns:	The active state.
+	///-------------------------------------------------------------------------------------------------
+
+	inline S GetActiveState() const { return (this->m_StateStackSize > 0 ? this->m_StateStack[this->m_StateStackSize - 1] : NullState()); }
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	inline void StaticFSM::UpdateStateMachine()
+	///
+	/// Summary:	Updates the state machine, that is, executes the active state's update procedure.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	inline void UpdateStateMachine()
+	{
+		if (this->m_ActiveState != NullState())
+			CallStateProc(T::GetStateTable().m_States[(size_t)this->m_ActiveState].onUpdate);
+	}
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void StaticFSM::ChangeState(S state)
+	///
+	/// Summary:	Change the current active state to a successor state. This won't push the old state
+	/// onto the stack, but change the current top state. Nothing changes, if the transition is not
+	/// allowed.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// state - 	The successor state.
+	///
+	/// Returns:	True, if the state was changed.
+	///-------------------------------------------------------------------------------------------------
+
+	bool ChangeState(S state)
+	{
+		assert((size_t)state < NUM_STATES && "Invalid state!");
+
+		if (IsTransitionAllowed(this->m_ActiveState, state) == false)
+		{
+			assert(false && "Invalid state transition!");
+			return false;
+		}
+
+		if (this->m_StateStackSize > 0)
+		{
+			// change active state
+			this->m_StateStack[this->m_StateStackSize - 1] = state;
+		}
+		else
+		{
+			// push initial state
+			this->m_StateStack[this->m_StateStackSize++] = state;
+		}
+
+		EnterState(state);
+		return true;
+	}
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void StaticFSM::PushState(S state)
+	///
+	/// Summary:	Change the current active state to a successor state. This operation will push the
+	/// old state onto the state stack, it can be restored by PopState. The push is refused, if the
+	/// stack is full, e.g. when a second pause request arrives before the game was resumed.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// state - 	The successor state.
+	///
+	/// Returns:	True, if the state was pushed.
+	///-------------------------------------------------------------------------------------------------
+
+	bool PushState(S state)
+	{
+		assert((size_t)state < NUM_STATES && "Invalid state!");
+
+		if (this->m_StateStackSize >= MAX_STATE_STACK_SIZE)
+			return false;
+
+		if (IsTransitionAllowed(this->m_ActiveState, state) == false)
+		{
+			assert(false && "Invalid state transition!");
+			return false;
+		}
+
+		// push new active state onto of the stack
+		this->m_StateStack[this->m_StateStackSize++] = state;
+
+		// change to new state
+		EnterState(state);
+		return true;
+	}
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void StaticFSM::PopState(bool activeOldState = true)
+	///
+	/// Summary:	Pops the current active state from stack and restores the previouse one. If there is no
+	/// previous state the null state will be active. If activeOldState flag is false, only the top state
+	/// will be popped, but the previous state won't be re-activated.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void PopState(bool activeOldState = true)
+	{
+		assert(this->m_StateStackSize > 0 && "State stack underflow!");
+
+		// remove active state from stack
+		this->m_StateStackSize--;
+
+		if (activeOldState == false)
+			return;
+
+		if (this->m_StateStackSize > 0)
+		{
+			// change back to previous state
+			this->ChangeState(this->m_StateStack[this->m_StateStackSize - 1]);
+		}
+		else
+		{
+			// if there is no previous state, change to null state
+			this->m_ActiveState = NullState();
+		}
+	}
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void StaticFSM::ResetFSM()
+	///
+	/// Summary:	Resets the FSM. This will clear the state stack and put the FSM to null state.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	void ResetFSM()
+	{
+		this->m_StateStackSize = 0;
+		this->m_ActiveState = NullState();
+	}
+
+}; // class StaticFSM
+
+#endif // __STATIC_FSM_H__
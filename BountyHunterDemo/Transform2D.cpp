@@ -0,0 +1,46 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	Transform2D.cpp.
+///
+/// Summary:	Implements the 2D transform class.
+///-------------------------------------------------------------------------------------------------
+
+#include "Transform2D.h"
+
+
+Transform2D::Transform2D() :
+	m_Position(0.0f),
+	m_Angle(0.0f),
+	m_Sin(0.0f),
+	m_Cos(1.0f),
+	m_Scale(1.0f)
+{}
+
+Transform2D::Transform2D(const Position2D& position, float angle, const glm::vec2& scale) :
+	m_Position(position),
+	m_Scale(scale)
+{
+	this->SetAngle(angle);
+}
+
+Transform2D::Transform2D(const glm::mat4& transform)
+{
+	const glm::vec2 X = glm::vec2(transform[0]);
+	const glm::vec2 Y = glm::vec2(transform[1]);
+
+	this->m_Position	= glm::vec2(transform[3]);
+	this->m_Scale		= glm::vec2(glm::length(X), glm::length(Y));
+
+	this->SetAngle(atan2(X.y, X.x));
+}
+
+glm::mat4 Transform2D::AsMat4() const
+{
+	const glm::vec2 X = this->GetRight();
+	const glm::vec2 Y = this->GetUp();
+
+	return glm::mat4(
+		X.x,					X.y,					0.0f,	0.0f,
+		Y.x,					Y.y,					0.0f,	0.0f,
+		0.0f,					0.0f,					1.0f,	0.0f,
+		this->m_Position.x,		this->m_Position.y,		0.0f,	1.0f);
+}
@@ -0,0 +1,88 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	Transform2D.h.
+///
+/// Summary:	Declares the 2D transform class. A 2D transform stores position, rotation angle and
+/// scale in the xy-plane, which is all the game needs. Unlike Transform, angle and scale can be read
+/// without decomposing a matrix.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __TRANSFORM_2D_H__
+#define __TRANSFORM_2D_H__
+
+#include "math.h"
+
+class Transform2D
+{
+private:
+
+	Position2D	m_Position;
+
+	// rotation around the z-axis in radians
+	float		m_Angle;
+
+	// cached sine and cosine of m_Angle
+	float		m_Sin;
+	float		m_Cos;
+
+	glm::vec2	m_Scale;
+
+public:
+
+	Transform2D();
+	Transform2D(const Position2D& position, float angle = 0.0f, const glm::vec2& scale = glm::vec2(1.0f));
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	explicit Transform2D::Transform2D(const glm::mat4& transform);
+	///
+	/// Summary:	Decomposes a 4x4 transformation matrix. Only translation in the xy-plane, rotation
+	/// around the z-axis and scale along x and y are kept.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// transform - 	The transform matrix.
+	///-------------------------------------------------------------------------------------------------
+
+	explicit Transform2D(const glm::mat4& transform);
+
+
+	inline void SetPosition(const Position2D& position) { this->m_Position = position; }
+
+	inline void SetAngle(float angle)
+	{
+		this->m_Angle	= angle;
+		this->m_Sin		= sin(angle);
+		this->m_Cos		= cos(angle);
+	}
+
+	inline void SetScale(const glm::vec2& scale) { this->m_Scale = scale; }
+
+	inline const Position2D& GetPosition() const { return this->m_Position; }
+
+	inline float GetAngle() const { return this->m_Angle; }
+
+	inline const glm::vec2& GetScale() const { return this->m_Scale; }
+
+	// scaled local x- and y-axis, same as Transform::GetRight/GetUp
+	inline glm::vec2 GetRight() const { return glm::vec2( this->m_Cos, this->m_Sin) * this->m_Scale.x; }
+	inline glm::vec2 GetUp() const { return glm::vec2(-this->m_Sin, this->m_Cos) * this->m_Scale.y; }
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	glm::mat4 Transform2D::AsMat4() const;
+	///
+	/// Summary:	Builds the 4x4 transformation matrix (translation * rotation * scale).
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Returns:	The transformation matrix.
+	///-------------------------------------------------------------------------------------------------
+
+	glm::mat4 AsMat4() const;
+
+}; // class Transform2D
+
+#endif // __TRANSFORM_2D_H__
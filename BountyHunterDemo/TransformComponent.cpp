@@ -9,10 +9,16 @@
 TransformComponent::TransformComponent()
 {}
 
-TransformComponent::TransformComponent(const glm::mat4& transform) : m_Transform(transform)
+TransformComponent::TransformComponent(const glm::mat4& transform) :
+	m_Transform2D(transform)
 {}
 
-TransformComponent::TransformComponent(const Transform& transform) : m_Transform(transform)
+TransformComponent::TransformComponent(const Transform& transform) :
+	m_Transform2D(transform)
+{}
+
+TransformComponent::TransformComponent(const Transform2D& transform) :
+	m_Transform2D(transform)
 {}
 
 TransformComponent::~TransformComponent()
@@ -10,28 +10,71 @@
 #include <ECS/ECS.h>
 
 #include "Transform.h"
+#include "Transform2D.h"
 
 class TransformComponent : public ECS::Component<TransformComponent>
 {
 private:
 
-	Transform	m_Transform;
+	Transform2D	m_Transform2D;
 
 public:
 
 	TransformComponent();
 	TransformComponent(const glm::mat4& transform);
 	TransformComponent(const Transform& transform);
+	TransformComponent(const Transform2D& transform);
 
 	virtual ~TransformComponent();
 
 
-	inline void SetTransform(const glm::mat4& transform) { this->m_Transform = transform; }
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	inline void TransformComponent::SetTransform(const glm::mat4& transform)
+	///
+	/// Summary:	Sets the transform from a 4x4 matrix. Only the 2D part (xy-translation, rotation
+	/// around z and xy-scale) is kept.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// transform - 	The transform.
+	///-------------------------------------------------------------------------------------------------
 
-	inline Transform* AsTransform() { return &(this->m_Transform); }
+	inline void SetTransform(const glm::mat4& transform) { this->m_Transform2D = Transform2D(transform); }
 
-	inline const float*		AsFloat() const { return this->m_Transform; }
-	inline const glm::mat4& AsMat4() const { return this->m_Transform; }
+	inline void SetTransform(const Transform2D& transform) { this->m_Transform2D = transform; }
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	inline void TransformComponent::SetTransform2D(float x, float y, float angle)
+	///
+	/// Summary:	Sets position and rotation around the z-axis, keeping the current scale. This is
+	/// the fast path used to sync the transform with a 2D physics body.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// x - 		The x coordinate.
+	/// y - 		The y coordinate.
+	/// angle - 	The rotation around the z-axis in radians.
+	///-------------------------------------------------------------------------------------------------
+
+	inline void SetTransform2D(float x, float y, float angle)
+	{
+		this->m_Transform2D.SetPosition(Position2D(x, y));
+		this->m_Transform2D.SetAngle(angle);
+	}
+
+	inline void SetPosition(const Position2D& position) { this->m_Transform2D.SetPosition(position); }
+
+	inline void SetScale(const glm::vec2& scale) { this->m_Transform2D.SetScale(scale); }
+
+	inline const glm::vec2& GetScale() const { return this->m_Transform2D.GetScale(); }
+
+	inline const Transform2D* AsTransform2D() const { return &(this->m_Transform2D); }
 
 }; // class TransformComponent
 
@@ -0,0 +1,105 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	WorkerPool.cpp.
+///
+/// Summary:	Implements the worker pool class.
+///-------------------------------------------------------------------------------------------------
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t numWorkers) :
+	m_Job(nullptr),
+	m_Count(0),
+	m_BatchSize(1),
+	m_NextIndex(0),
+	m_ActiveWorkers(0),
+	m_Generation(0),
+	m_Shutdown(false)
+{
+	for (size_t i = 0; i < numWorkers; ++i)
+		this->m_Workers.emplace_back(&WorkerPool::WorkerLoop, this, i + 1);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		this->m_Shutdown = true;
+	}
+
+	this->m_WorkSignal.notify_all();
+
+	for (auto& worker : this->m_Workers)
+		worker.join();
+}
+
+void WorkerPool::WorkerLoop(size_t thread)
+{
+	size_t generation = 0;
+
+	std::unique_lock<std::mutex> lock(this->m_Mutex);
+	while (true)
+	{
+		this->m_WorkSignal.wait(lock, [&] { return this->m_Shutdown == true || this->m_Generation != generation; });
+
+		if (this->m_Shutdown == true)
+			return;
+
+		generation = this->m_Generation;
+
+		lock.unlock();
+		RunBatches(thread);
+		lock.lock();
+
+		if (--this->m_ActiveWorkers == 0)
+			this->m_DoneSignal.notify_one();
+	}
+}
+
+void WorkerPool::RunBatches(size_t thread)
+{
+	while (true)
+	{
+		const size_t begin = this->m_NextIndex.fetch_add(this->m_BatchSize);
+		if (begin >= this->m_Count)
+			return;
+
+		(*this->m_Job)(begin, std::min(begin + this->m_BatchSize, this->m_Count), thread);
+	}
+}
+
+void WorkerPool::ParallelFor(size_t count, size_t batchSize, const Job& job)
+{
+	if (count == 0)
+		return;
+
+	// not worth waking the workers
+	if (this->m_Workers.empty() == true || count <= batchSize)
+	{
+		job(0, count, 0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+		this->m_Job = &job;
+		this->m_Count = count;
+		this->m_BatchSize = std::max<size_t>(batchSize, 1);
+		this->m_NextIndex = 0;
+
+		this->m_ActiveWorkers = this->m_Workers.size();
+		this->m_Generation++;
+	}
+
+	this->m_WorkSignal.notify_all();
+
+	// calling thread helps
+	RunBatches(0);
+
+	std::unique_lock<std::mutex> lock(this->m_Mutex);
+	this->m_DoneSignal.wait(lock, [this] { return this->m_ActiveWorkers == 0; });
+
+	this->m_Job = nullptr;
+}
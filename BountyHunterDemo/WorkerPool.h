@@ -0,0 +1,82 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	WorkerPool.h.
+///
+/// Summary:	Declares the worker pool class. A small pool of threads, which run a loop body
+/// (ParallelFor) together with the calling thread.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __WORKER_POOL_H__
+#define __WORKER_POOL_H__
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+class WorkerPool
+{
+public:
+
+	// runs iterations [begin, end) on thread 'thread', where thread 0 is the calling thread
+	using Job = std::function<void(size_t begin, size_t end, size_t thread)>;
+
+private:
+
+	std::vector<std::thread>	m_Workers;
+
+	std::mutex					m_Mutex;
+	std::condition_variable		m_WorkSignal;
+	std::condition_variable		m_DoneSignal;
+
+	// current job, valid while m_ActiveWorkers > 0
+	const Job*					m_Job;
+	size_t						m_Count;
+	size_t						m_BatchSize;
+	std::atomic<size_t>			m_NextIndex;
+
+	size_t						m_ActiveWorkers;
+
+	// incremented for every job, so each worker takes part in every job exactly once
+	size_t						m_Generation;
+
+	bool						m_Shutdown;
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	void WorkerLoop(size_t thread);
+
+	// takes batches of the current job until all are taken
+	void RunBatches(size_t thread);
+
+public:
+
+	explicit WorkerPool(size_t numWorkers);
+	~WorkerPool();
+
+	///-------------------------------------------------------------------------------------------------
+	/// Fn:	void WorkerPool::ParallelFor(size_t count, size_t batchSize, const Job& job);
+	///
+	/// Summary:	Runs job for iterations [0, count) in batches of batchSize iterations on all workers
+	/// and the calling thread. Returns after all iterations were run.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Parameters:
+	/// count - 		Number of iterations.
+	/// batchSize - 	Number of iterations taken by a thread at once.
+	/// job - 			The loop body.
+	///-------------------------------------------------------------------------------------------------
+
+	void ParallelFor(size_t count, size_t batchSize, const Job& job);
+
+	// number of threads running a job, including the calling thread
+	inline size_t GetNumThreads() const { return this->m_Workers.size() + 1; }
+
+}; // class WorkerPool
+
+#endif // __WORKER_POOL_H__
@@ -0,0 +1,46 @@
+///-------------------------------------------------------------------------------------------------
+/// File:	WorldGrid.h.
+///
+/// Summary:	Declares the world grid class, the layout of a uniform grid over the world bounds.
+///-------------------------------------------------------------------------------------------------
+
+#ifndef __WORLD_GRID_H__
+#define __WORLD_GRID_H__
+
+#include "GameConfiguration.h"
+#include "math.h"
+
+///-------------------------------------------------------------------------------------------------
+/// Struct:	WorldGrid
+///
+/// Summary:	Maps positions to the cells of a uniform grid over the world bounds. Cells are
+/// stored row by row, positions outside the world bounds are clamped to the border cells.
+///
+/// Author:	Tobias Stein
+///
+/// Date:	17/10/2026
+///-------------------------------------------------------------------------------------------------
+
+struct WorldGrid
+{
+	float	m_CellSize;
+
+	int		m_CellsX;
+	int		m_CellsY;
+
+	constexpr WorldGrid(float cellSize) :
+		m_CellSize(cellSize),
+		m_CellsX((int)((WORLD_BOUND_MAX[0] - WORLD_BOUND_MIN[0]) / cellSize) + 1),
+		m_CellsY((int)((WORLD_BOUND_MAX[1] - WORLD_BOUND_MIN[1]) / cellSize) + 1)
+	{}
+
+	constexpr int GetCellCount() const { return this->m_CellsX * this->m_CellsY; }
+
+	inline int CellX(float x) const { return glm::clamp((int)((x - WORLD_BOUND_MIN[0]) / this->m_CellSize), 0, this->m_CellsX - 1); }
+	inline int CellY(float y) const { return glm::clamp((int)((y - WORLD_BOUND_MIN[1]) / this->m_CellSize), 0, this->m_CellsY - 1); }
+
+	inline uint32_t Cell(const Position2D& position) const { return CellY(position.y) * this->m_CellsX + CellX(position.x); }
+
+}; // struct WorldGrid
+
+#endif // __WORLD_GRID_H__
@@ -5,6 +5,7 @@
 ///-------------------------------------------------------------------------------------------------
 
 #include "WorldSystem.h"
+#include "Profiler.h"
 #include "PhysicsSystem.h"
 
 WorldSystem::WorldSystem() :
@@ -25,6 +26,8 @@ WorldSystem::~WorldSystem()
 
 void WorldSystem::PreUpdate(float dt)
 {
+	PROFILE_SCOPE("WorldSystem::PreUpdate");
+
 	// process all pending spawns
 	for (size_t i = 0; i < this->m_PendingSpawns; ++i)
 	{
@@ -37,11 +40,11 @@ void WorldSystem::PreUpdate(float dt)
 			assert(entityTransformComponent != nullptr && "Failure! Spawned entity has no TransformComponent!");
 
 			// set initial transform
-			*entityTransformComponent = this->m_SpawnQueue[i].m_Transform;
+			entityTransformComponent->SetTransform(this->m_SpawnQueue[i].m_Transform);
 
 			entity->SetActive(true);
 
-			ECS::ECS_Engine->SendEvent<GameObjectSpawned>(this->m_SpawnQueue[i].m_GameObjectID, *entityTransformComponent->AsTransform());
+			ECS::ECS_Engine->SendEvent<GameObjectSpawned>(this->m_SpawnQueue[i].m_GameObjectID, *entityTransformComponent->AsTransform2D());
 		}
 	}
 
@@ -50,11 +53,38 @@ void WorldSystem::PreUpdate(float dt)
 
 void WorldSystem::Update(float dt)
 {
+	PROFILE_SCOPE("WorldSystem::Update");
+
+	const Profiler::Clock::time_point STEP_BEGIN = Profiler::Clock::now();
+
 	this->m_Box2DWorld.Step(dt, PHYSICS_VELOCITY_ITERATIONS, PHYSICS_POSITION_ITERATIONS);
+
+	if (PROFILER_ENABLED == true)
+	{
+		static const Profiler::ProbeId COLLIDE_PROBE	= g_Profiler.GetProbe("b2World::Step [collide]");
+		static const Profiler::ProbeId SOLVE_PROBE		= g_Profiler.GetProbe("b2World::Step [solve]");
+		static const Profiler::ProbeId BROADPHASE_PROBE	= g_Profiler.GetProbe("b2World::Step [solve/broadphase]");
+		static const Profiler::ProbeId SOLVE_TOI_PROBE	= g_Profiler.GetProbe("b2World::Step [solveTOI]");
+
+		// Box2D only reports the duration of its step phases, which run in order collide, solve 
+		// (finding new contacts in the broadphase last) and solveTOI.
+		const b2Profile& profile = this->m_Box2DWorld.GetProfile();
+
+		const Profiler::Clock::time_point SOLVE_BEGIN		= STEP_BEGIN + std::chrono::duration_cast<Profiler::Clock::duration>(std::chrono::duration<float, std::milli>(profile.collide));
+		const Profiler::Clock::time_point SOLVE_TOI_BEGIN	= SOLVE_BEGIN + std::chrono::duration_cast<Profiler::Clock::duration>(std::chrono::duration<float, std::milli>(profile.solve));
+		const Profiler::Clock::time_point BROADPHASE_BEGIN	= SOLVE_TOI_BEGIN - std::chrono::duration_cast<Profiler::Clock::duration>(std::chrono::duration<float, std::milli>(profile.broadphase));
+
+		g_Profiler.AddSample(COLLIDE_PROBE, STEP_BEGIN, profile.collide, true);
+		g_Profiler.AddSample(SOLVE_PROBE, SOLVE_BEGIN, profile.solve, true);
+		g_Profiler.AddSample(BROADPHASE_PROBE, BROADPHASE_BEGIN, profile.broadphase, true);
+		g_Profiler.AddSample(SOLVE_TOI_PROBE, SOLVE_TOI_BEGIN, profile.solveTOI, true);
+	}
 }
 
 void WorldSystem::PostUpdate(float dt)
 {
+	PROFILE_SCOPE("WorldSystem::PostUpdate");
+
 	// process all pending kills
 	for (size_t i = 0; i < this->m_PendingKills; ++i)
 	{
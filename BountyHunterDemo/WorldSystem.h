@@ -177,7 +177,7 @@ public:
 				rbComp->m_Box2DBody = this->m_Box2DWorld.CreateBody(&bodyDef);
 
 				// set initial transform
-				rbComp->SetTransform(*entityTransformComponent->AsTransform());
+				rbComp->SetTransform(*entityTransformComponent->AsTransform2D());
 
 				if (coComp != nullptr)
 				{
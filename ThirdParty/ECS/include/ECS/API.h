@@ -25,6 +25,12 @@ Preprocessor defines:
 
 #define COMPONENT_T_CHUNK_SIZE				512
 
+// max. number of component types, size of a system's component access mask
+#define MAX_COMPONENT_TYPES					64
+
+// max. number of system types, size of a system's access mask
+#define MAX_SYSTEM_TYPES					64
+
 // 4MB 
 #define ECS_EVENT_MEMORY_BUFFER_SIZE		4194304
 
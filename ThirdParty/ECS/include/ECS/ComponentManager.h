@@ -15,12 +15,15 @@
 #include "API.h"
 #include "Engine.h"
 
+#include "IEntity.h"
 #include "IComponent.h"
 
 #include "util/FamilyTypeID.h"
 
 #include "Memory/MemoryChunkAllocator.h"
 
+#include "ComponentView.h"
+
 
 
 namespace ECS
@@ -54,7 +57,7 @@ namespace ECS
 
 		public:
 		
-			ComponentContainer() : MemoryChunkAllocator("ComponentManager")
+			ComponentContainer() : Memory::MemoryChunkAllocator<T, COMPONENT_T_CHUNK_SIZE>("ComponentManager")
 			{}
 
 			virtual ~ComponentContainer()
@@ -193,6 +196,8 @@ namespace ECS
 		{
 			const ComponentTypeId CTID = T::STATIC_COMPONENT_TYPE_ID;
 
+			assert(CTID < this->m_EntityComponentMap[entityId.index].size() && "FATAL: Component type id out of range of the entity component map!");
+
 			const ComponentId componentId = this->m_EntityComponentMap[entityId.index][CTID];
 
 			IComponent* component = this->m_ComponentLUT[componentId];
@@ -255,6 +260,8 @@ namespace ECS
 		{
 			const ComponentTypeId CTID = T::STATIC_COMPONENT_TYPE_ID;
 
+			assert(CTID < this->m_EntityComponentMap[entityId.index].size() && "FATAL: Component type id out of range of the entity component map!");
+
 			const ComponentId componentId = this->m_EntityComponentMap[entityId.index][CTID];
 
 			// entity has no component of type T
@@ -308,8 +315,103 @@ namespace ECS
 			return GetComponentContainer<T>()->end();
 		}
 
+		///-------------------------------------------------------------------------------------------------
+		/// Fn:	template<class T, class F> inline void ComponentManager::ForEachComponent(F&& func)
+		///
+		/// Summary:	Calls func(T&) for every component of type T in storage order.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///
+		/// Typeparams:
+		/// T - 	Component type.
+		/// F - 	Callable type.
+		/// Parameters:
+		/// func - 	The function to call.
+		///-------------------------------------------------------------------------------------------------
+
+		template<class T, class F>
+		inline void ForEachComponent(F&& func)
+		{
+			ComponentContainer<T>* container = GetComponentContainer<T>();
+
+			for (auto it = container->begin(); it != container->end(); ++it)
+				func(*it);
+		}
+
+		///-------------------------------------------------------------------------------------------------
+		/// Fn:	template<class T> inline size_t ComponentManager::GetComponentVersion()
+		///
+		/// Summary:	Returns the version of the components of type T, which changes whenever such a
+		/// component is created or destroyed.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///
+		/// Typeparams:
+		/// T - 	Component type.
+		///
+		/// Returns:	The version.
+		///-------------------------------------------------------------------------------------------------
+
+		template<class T>
+		inline size_t GetComponentVersion()
+		{
+			return GetComponentContainer<T>()->GetVersion();
+		}
+
 	}; // ComponentManager
 
+	template<class... T>
+	void ComponentView<T...>::Refresh()
+	{
+		const ComponentVersions versions { { this->m_ComponentManagerInstance->template GetComponentVersion<T>()... } };
+		if (versions == this->m_ComponentVersions)
+			return;
+
+		this->m_Entries.clear();
+
+		using First = typename std::tuple_element<0, std::tuple<T...>>::type;
+
+		// every entity in the view has a component of the first type, visit them in storage order
+		for (auto it = this->m_ComponentManagerInstance->template begin<First>(); it != this->m_ComponentManagerInstance->template end<First>(); ++it)
+		{
+			const EntityId entityId = it->GetOwner();
+
+			const std::tuple<T*...> components { this->m_ComponentManagerInstance->template GetComponent<T>(entityId)... };
+
+			bool complete = true;
+
+			using expand = int[];
+			(void)expand { 0, (complete = complete && std::get<T*>(components) != nullptr, 0)... };
+
+			if (complete == true)
+				this->m_Entries.emplace_back(entityId, std::get<T*>(components)...);
+		}
+
+		this->m_ComponentVersions = versions;
+	}
+
+
+	template<class T>
+	T* IEntity::GetComponent() const
+	{
+		return this->m_ComponentManagerInstance->GetComponent<T>(this->m_EntityID);
+	}
+
+	template<class T, class ...P>
+	T* IEntity::AddComponent(P&&... param)
+	{
+		return this->m_ComponentManagerInstance->AddComponent<T>(this->m_EntityID, std::forward<P>(param)...);
+	}
+
+	template<class T>
+	void IEntity::RemoveComponent()
+	{
+		this->m_ComponentManagerInstance->RemoveComponent<T>(this->m_EntityID);
+	}
 
 } // namespace ECS
 
@@ -0,0 +1,142 @@
+/*
+	Author : Tobias Stein
+	Date   : 17th October, 2026
+	File   : ComponentView.h
+
+	Cached list of all entities which have a certain set of components.
+
+	All Rights Reserved. (c) Copyright 2016 - 2017.
+*/
+
+#ifndef __COMPONENT_VIEW_H__
+#define __COMPONENT_VIEW_H__
+
+#include "API.h"
+
+#include "IEntity.h"
+#include "IComponent.h"
+
+#include <vector>
+#include <tuple>
+#include <array>
+#include <limits>
+
+namespace ECS
+{
+	class ComponentManager;
+
+	///-------------------------------------------------------------------------------------------------
+	/// Class:	ComponentView
+	///
+	/// Summary:	A view of all entities which have components of all types T. The view caches the
+	/// components of these entities, so iterating a view does not look up any component. It is rebuilt
+	/// on its next use, whenever a component of one of the types T was created or destroyed, no matter
+	/// if by the ComponentManager or on entity destruction. Components of the types T must not be added
+	/// or removed while iterating the view.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///
+	/// Typeparams:
+	/// T - 	Component types.
+	///-------------------------------------------------------------------------------------------------
+
+	template<class... T>
+	class ComponentView
+	{
+		static_assert(sizeof...(T) > 0, "A ComponentView needs at least one component type!");
+
+	public:
+
+		class Entry
+		{
+			EntityId			m_EntityId;
+			std::tuple<T*...>	m_Components;
+
+		public:
+
+			Entry(const EntityId entityId, T*... components) :
+				m_EntityId(entityId),
+				m_Components(components...)
+			{}
+
+			inline const EntityId GetEntityId() const { return this->m_EntityId; }
+
+			template<class C>
+			inline C& Get() const { return *std::get<C*>(this->m_Components); }
+		};
+
+		using Entries	= std::vector<Entry>;
+		using iterator	= typename Entries::const_iterator;
+
+	private:
+
+		using ComponentVersions = std::array<size_t, sizeof...(T)>;
+
+		ComponentManager*		m_ComponentManagerInstance;
+
+		Entries					m_Entries;
+
+		// versions of the component containers of the types T the view was built from
+		ComponentVersions		m_ComponentVersions;
+
+		ComponentView(const ComponentView&) = delete;
+		ComponentView& operator=(ComponentView&) = delete;
+
+		// rebuilds the view, if a component of one of the types T was created or destroyed since it was built, see ComponentManager.h
+		void Refresh();
+
+	public:
+
+		explicit ComponentView(ComponentManager* componentManager) :
+			m_ComponentManagerInstance(componentManager)
+		{
+			// built on first use
+			this->m_ComponentVersions.fill(std::numeric_limits<size_t>::max());
+		}
+
+		~ComponentView()
+		{}
+
+		inline size_t size()
+		{
+			Refresh();
+			return this->m_Entries.size();
+		}
+
+		inline iterator begin()
+		{
+			Refresh();
+			return this->m_Entries.cbegin();
+		}
+
+		inline iterator end() { return this->m_Entries.cend(); }
+
+		///-------------------------------------------------------------------------------------------------
+		/// Fn:	template<class F> inline void ComponentView::ForEach(F&& func)
+		///
+		/// Summary:	Calls func(T&...) for every entity in the view.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///
+		/// Typeparams:
+		/// F - 	Callable type.
+		/// Parameters:
+		/// func - 	The function to call.
+		///-------------------------------------------------------------------------------------------------
+
+		template<class F>
+		inline void ForEach(F&& func)
+		{
+			for (auto it = begin(); it != end(); ++it)
+				func(it->template Get<T>()...);
+		}
+
+	}; // class ComponentView
+
+} // namespace ECS
+
+#endif // __COMPONENT_VIEW_H__
\ No newline at end of file
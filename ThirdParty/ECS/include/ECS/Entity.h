@@ -13,6 +13,7 @@
 
 
 #include "IEntity.h"
+#include "util/FamilyTypeID.h"
 
 namespace ECS {
 
@@ -34,8 +35,16 @@ namespace ECS {
 	class Entity : public IEntity
 	{
 		// Entity destruction always happens through EntityManager !!!
+#if defined(_MSC_VER)
 		void operator delete(void*) = delete;
 		void operator delete[](void*) = delete;
+#else
+	public:
+
+		// GCC/Clang need an accessible operator delete for the virtual d'tor of derived entities
+		void operator delete(void*) { assert(false && "Entity destruction always happens through EntityManager!"); }
+		void operator delete[](void*) { assert(false && "Entity destruction always happens through EntityManager!"); }
+#endif
 
 	public:
 
@@ -54,7 +63,7 @@ namespace ECS {
 
 	// set unique type id for this Entity<T>
 	template<class E>
-	const EntityTypeId Entity<E>::STATIC_ENTITY_TYPE_ID = util::Internal::FamilyTypeID<IEntity>::Get<E>();
+	const EntityTypeId Entity<E>::STATIC_ENTITY_TYPE_ID = util::Internal::FamilyTypeID<IEntity>::template Get<E>();
 }
 
 #endif // __ENTITY_H__
\ No newline at end of file
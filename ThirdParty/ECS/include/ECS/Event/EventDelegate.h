@@ -13,6 +13,8 @@
 
 #include "Platform.h"
 
+#include <cstring>
+
 namespace ECS { namespace Event {
 
 	class IEvent;
@@ -20,6 +22,79 @@ namespace ECS { namespace Event {
 	namespace Internal
 	{
 		using EventDelegateId = size_t;
+
+
+		///-------------------------------------------------------------------------------------------------
+		/// Class:	EventCallback
+		///
+		/// Summary:	A type erased receiver and member function pair. The member function pointer is
+		/// stored in place and invoked through a non-virtual thunk, so callbacks can be stored by value
+		/// in contiguous memory and need no heap allocation.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///-------------------------------------------------------------------------------------------------
+
+		class EventCallback
+		{
+			using InvokeFunction = void(*)(void* receiver, const void* callback, const IEvent* const e);
+
+			// large enough for member function pointers of all inheritance models
+			static constexpr size_t CALLBACK_STORAGE_SIZE { 4 * sizeof(void*) };
+
+			void*			m_Receiver;
+			InvokeFunction	m_Invoke;
+
+			alignas(void*) unsigned char m_Callback[CALLBACK_STORAGE_SIZE];
+
+			template<class Class, class EventType>
+			static void Invoke(void* receiver, const void* callback, const IEvent* const e)
+			{
+				typedef void(Class::*Callback)(const EventType* const);
+				(static_cast<Class*>(receiver)->*(*reinterpret_cast<const Callback*>(callback)))(reinterpret_cast<const EventType* const>(e));
+			}
+
+		public:
+
+			EventCallback() :
+				m_Receiver(nullptr),
+				m_Invoke(nullptr)
+			{
+				std::memset(this->m_Callback, 0, CALLBACK_STORAGE_SIZE);
+			}
+
+			template<class Class, class EventType>
+			EventCallback(Class* receiver, void(Class::*callbackFunction)(const EventType* const)) :
+				m_Receiver(receiver),
+				m_Invoke(&EventCallback::Invoke<Class, EventType>)
+			{
+				static_assert(sizeof(callbackFunction) <= CALLBACK_STORAGE_SIZE, "Member function pointer exceeds callback storage.");
+
+				// note: zero unused bytes, callbacks are compared bytewise
+				std::memset(this->m_Callback, 0, CALLBACK_STORAGE_SIZE);
+				std::memcpy(this->m_Callback, &callbackFunction, sizeof(callbackFunction));
+			}
+
+			inline void invoke(const IEvent* const e) const
+			{
+				this->m_Invoke(this->m_Receiver, this->m_Callback, e);
+			}
+
+			inline bool IsValid() const { return this->m_Invoke != nullptr; }
+
+			inline void Reset()
+			{
+				this->m_Receiver = nullptr;
+				this->m_Invoke = nullptr;
+			}
+
+			inline bool operator==(const EventCallback& other) const
+			{
+				return ((this->m_Receiver == other.m_Receiver) && (this->m_Invoke == other.m_Invoke) && (std::memcmp(this->m_Callback, other.m_Callback, CALLBACK_STORAGE_SIZE) == 0));
+			}
+
+		}; // class EventCallback
 	
 	
 		class IEventDelegate
@@ -36,6 +111,12 @@ namespace ECS { namespace Event {
 
 			virtual IEventDelegate* clone() = 0;
 
+			virtual const EventCallback& GetCallback() const = 0;
+
+			// note: declared last, so the slots of the functions above stay where the ECS library expects them
+			virtual ~IEventDelegate()
+			{}
+
 		}; // class IEventDelegate
 	
 		template<class Class, class EventType>
@@ -43,24 +124,27 @@ namespace ECS { namespace Event {
 		{
 			typedef void(Class::*Callback)(const EventType* const);
 
-			Class* m_Receiver;
-			Callback m_Callback;
+			EventCallback m_Callback;
 	
 		public:
 	
 			EventDelegate(Class* receiver, Callback& callbackFunction) :
-				m_Receiver(receiver),
-				m_Callback(callbackFunction)
+				m_Callback(receiver, callbackFunction)
 			{}
 
 			virtual IEventDelegate* clone() override
 			{
-				return new EventDelegate(this->m_Receiver, this->m_Callback);
+				return new EventDelegate(*this);
 			}
 
 			virtual inline void invoke(const IEvent* const e) override
 			{
-				(m_Receiver->*m_Callback)(reinterpret_cast<const EventType* const>(e));
+				this->m_Callback.invoke(e);
+			}
+
+			virtual const EventCallback& GetCallback() const override
+			{
+				return this->m_Callback;
 			}
 	
 			virtual inline EventDelegateId GetDelegateId() const override
@@ -78,14 +162,10 @@ namespace ECS { namespace Event {
 
 			virtual bool operator==(const IEventDelegate* other) const override
 			{
-				if (this->GetDelegateId() != other->GetDelegateId())
-					return false;
-
-				EventDelegate* delegate = (EventDelegate*)other;
-				if (other == nullptr)
+				if (other == nullptr || this->GetDelegateId() != other->GetDelegateId())
 					return false;
 
-				return ((this->m_Callback == delegate->m_Callback) && (this->m_Receiver == delegate->m_Receiver));
+				return this->m_Callback == other->GetCallback();
 			}
 
 		}; // class EventDelegate
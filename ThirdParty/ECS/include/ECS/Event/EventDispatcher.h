@@ -14,6 +14,9 @@
 #include "API.h"
 #include "IEventDispatcher.h"
 
+#include <vector>
+#include <algorithm>
+
 namespace ECS { namespace Event { namespace Internal {
 
 	template<class T>
@@ -21,32 +24,59 @@ namespace ECS { namespace Event { namespace Internal {
 	{
 		DECLARE_STATIC_LOGGER
 
-		using EventDelegateList			= std::list<IEventDelegate*>;
+		struct EventCallbackSlot
+		{
+			EventCallback		m_Callback;
+
+			// delegate the callback was added with, owned by the dispatcher
+			IEventDelegate*		m_Delegate;
+		};
 
-		//using PendingAddDelegates		= std::list<IEventDelegate*>;
-		using PendingRemoveDelegates	= std::list<IEventDelegate*>;
+		// callbacks are stored by value, removed callbacks are reset (tombstone) and compacted after dispatch
+		using EventCallbackList			= std::vector<EventCallbackSlot>;
 
-		//PendingAddDelegates		m_PendingAddDelegates;
-		PendingRemoveDelegates	m_PendingRemoveDelegates;
+		EventCallbackList		m_EventCallbacks;
 
-		EventDelegateList		m_EventCallbacks;
+		size_t					m_EventCallbackCount;
 
 		bool					m_Locked;
+		bool					m_HasTombstones;
+
+		inline typename EventCallbackList::iterator FindEventCallback(const EventCallback& eventCallback)
+		{
+			return std::find_if(this->m_EventCallbacks.begin(), this->m_EventCallbacks.end(),
+				[&](const EventCallbackSlot& slot)
+				{
+					return slot.m_Callback == eventCallback;
+				});
+		}
+
+		// removes all tombstones, keeps the order of the remaining callbacks
+		inline void Compact()
+		{
+			this->m_EventCallbacks.erase(std::remove_if(this->m_EventCallbacks.begin(), this->m_EventCallbacks.end(),
+				[](const EventCallbackSlot& slot)
+				{
+					return slot.m_Callback.IsValid() == false;
+				}), this->m_EventCallbacks.end());
+
+			this->m_HasTombstones = false;
+		}
 
 	public:
-	
+
 		// never use!
 		EventDispatcher() :
-			m_Locked(false)
+			m_EventCallbackCount(0),
+			m_Locked(false),
+			m_HasTombstones(false)
 		{}
-	
+
 		virtual ~EventDispatcher()
 		{
-			//this->m_PendingAddDelegates.clear();
-			this->m_PendingRemoveDelegates.clear();
 			this->m_EventCallbacks.clear();
 		}
-	
+
 		// send event to all listener
 		inline void Dispatch(IEvent* event) override
 		{
@@ -54,96 +84,49 @@ namespace ECS { namespace Event { namespace Internal {
 			{
 				LogTrace("Dispatch event %s", typeid(T).name());
 
-				// remove pending delegates
-				if (this->m_PendingRemoveDelegates.empty() == false)
-				{
-					for (auto EC : this->m_PendingRemoveDelegates)
-					{
-						auto result = std::find_if(this->m_EventCallbacks.begin(), this->m_EventCallbacks.end(),
-							[&](const IEventDelegate* other)
-							{
-								return other->operator==(EC);
-							});
-
-						if (result != this->m_EventCallbacks.end())
-						{
-							IEventDelegate* ptrMem = (IEventDelegate*)(*result);
-
-							this->m_EventCallbacks.erase(result);
-
-							delete ptrMem;
-							ptrMem = nullptr;
-						}
-					}
-					this->m_PendingRemoveDelegates.clear();
-				}
-
-				for (auto EC : this->m_EventCallbacks)
+				// note: iterate by index, callbacks may be added while dispatching
+				for (size_t i = 0; i < this->m_EventCallbacks.size(); ++i)
 				{
-					assert(EC != nullptr && "Invalid event callback.");
-					EC->invoke(event);
+					const EventCallback EC = this->m_EventCallbacks[i].m_Callback;
+					if (EC.IsValid() == true)
+						EC.invoke(event);
 				}
 			}
 			this->m_Locked = false;
+
+			if (this->m_HasTombstones == true)
+				Compact();
 		}
 
 		virtual void AddEventCallback(IEventDelegate* const eventDelegate) override
 		{
-			// if delegate wasn't deleted since last update, that is, delegate is still in pending list,
-			// remove it from pending list
-			auto result = std::find_if(this->m_PendingRemoveDelegates.begin(), this->m_PendingRemoveDelegates.end(),
-				[&](const IEventDelegate* other)
-				{
-					return other->operator==(eventDelegate);
-				});
-
-			if (result != this->m_PendingRemoveDelegates.end())
-			{
-				this->m_PendingRemoveDelegates.erase(result);
-				return;
-			}
-
-			this->m_EventCallbacks.push_back(eventDelegate);
+			this->m_EventCallbacks.push_back({ eventDelegate->GetCallback(), eventDelegate });
+			this->m_EventCallbackCount++;
 		}
 
 		virtual void RemoveEventCallback(IEventDelegate* eventDelegate) override
-		{ 
-			if (this->m_Locked == false)
-			{
-				auto result = std::find_if(this->m_EventCallbacks.begin(), this->m_EventCallbacks.end(),
-					[&](const IEventDelegate* other)
-					{
-						return other->operator==(eventDelegate);
-					});
+		{
+			auto result = FindEventCallback(eventDelegate->GetCallback());
+			if (result == this->m_EventCallbacks.end())
+				return;
 
-				if (result != this->m_EventCallbacks.end())
-				{
-					IEventDelegate* ptrMem = (IEventDelegate*)(*result);
+			delete result->m_Delegate;
+			result->m_Delegate = nullptr;
 
-					this->m_EventCallbacks.erase(result);
+			result->m_Callback.Reset();
 
-					delete ptrMem;
-					ptrMem = nullptr;
-				}
-			}
-			else
-			{
-				auto result = std::find_if(this->m_EventCallbacks.begin(), this->m_EventCallbacks.end(),
-					[&](const IEventDelegate* other)
-					{
-						return other->operator==(eventDelegate);
-					});
-
-				assert(result != this->m_EventCallbacks.end() && "");
-				this->m_PendingRemoveDelegates.push_back((*result));
-			}
+			this->m_EventCallbackCount--;
+			this->m_HasTombstones = true;
+
+			if (this->m_Locked == false)
+				Compact();
 		}
 
-		virtual inline size_t GetEventCallbackCount() const override { return this->m_EventCallbacks.size(); }
+		virtual inline size_t GetEventCallbackCount() const override { return this->m_EventCallbackCount; }
 	};
 
 	DEFINE_STATIC_LOGGER_TEMPLATE(EventDispatcher, T, "EventDispatcher")
 
 }}} // namespace ECS::Event::Internal
 
-#endif // __EVENT_DISPATCHER_H__
\ No newline at end of file
+#endif // __EVENT_DISPATCHER_H__
@@ -21,10 +21,124 @@
 
 namespace ECS { namespace Event {
 
+	namespace Internal
+	{
+		///-------------------------------------------------------------------------------------------------
+		/// Class:	EventMemoryPages
+		///
+		/// Summary:	Event memory used once the event handler's event buffer is full, so events are
+		/// not cut off. Pages are added as needed and kept until the program exits.
+		/// 
+		/// note: the event buffer is cleared by the EventHandler::DispatchEvents() compiled into the ECS
+		/// library, which does not know these pages. So they are recycled by the next EventHandler::Send()
+		/// instead, that is, as soon as no buffered event is left.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///-------------------------------------------------------------------------------------------------
+
+		class EventMemoryPages
+		{
+			struct Page
+			{
+				void*	m_Memory;
+				size_t	m_Size;
+				size_t	m_Used;
+			};
+
+			using Pages = std::vector<Page>;
+
+			Pages		m_Pages;
+
+			// page events are currently allocated from
+			size_t		m_Page;
+
+			// event memory used on all pages
+			size_t		m_MemoryUsed;
+
+			// most event memory ever used by buffered events, including the event buffer
+			size_t		m_HighWaterMark;
+
+		public:
+
+			EventMemoryPages() :
+				m_Page(0),
+				m_MemoryUsed(0),
+				m_HighWaterMark(0)
+			{}
+
+			~EventMemoryPages()
+			{
+				for (auto& page : this->m_Pages)
+					::operator delete(page.m_Memory);
+			}
+
+			void* allocate(size_t size, u8 alignment)
+			{
+				while (true)
+				{
+					if (this->m_Page == this->m_Pages.size())
+					{
+						const size_t pageSize = std::max<size_t>(ECS_EVENT_MEMORY_BUFFER_SIZE, size + alignment);
+						this->m_Pages.push_back({ ::operator new(pageSize), pageSize, 0 });
+					}
+
+					Page& page = this->m_Pages[this->m_Page];
+
+					void* address = (u8*)page.m_Memory + page.m_Used;
+					const size_t adjustment = Memory::Allocator::GetAdjustment(address, alignment);
+
+					if (page.m_Used + adjustment + size <= page.m_Size)
+					{
+						page.m_Used += adjustment + size;
+						this->m_MemoryUsed += adjustment + size;
+
+						return (u8*)address + adjustment;
+					}
+
+					// page is full, continue on the next one
+					this->m_Page++;
+				}
+			}
+
+			void clear()
+			{
+				for (auto& page : this->m_Pages)
+					page.m_Used = 0;
+
+				this->m_Page = 0;
+				this->m_MemoryUsed = 0;
+			}
+
+			inline void UpdateHighWaterMark(size_t eventBufferUsed)
+			{
+				this->m_HighWaterMark = std::max(this->m_HighWaterMark, eventBufferUsed + this->m_MemoryUsed);
+			}
+
+			inline size_t GetPageCount() const { return this->m_Pages.size(); }
+
+			inline size_t GetHighWaterMark() const { return this->m_HighWaterMark; }
+		};
+
+		inline EventMemoryPages& GetEventMemoryPages()
+		{
+			static EventMemoryPages EVENT_MEMORY_PAGES;
+			return EVENT_MEMORY_PAGES;
+		}
+
+	} // namespace Internal
+
+	// Returns the most event memory in bytes ever used by buffered events during one update
+	inline size_t GetEventMemoryHighWaterMark()
+	{
+		return Internal::GetEventMemoryPages().GetHighWaterMark();
+	}
+
 	class ECS_API EventHandler : Memory::GlobalMemoryUser
 	{
 		// allow IEventListener access private methods for Add/Remove callbacks
-		friend class ECSEngine;
+		friend class ECS::ECSEngine;
 	
 
 		using EventDispatcherMap = std::unordered_map<EventTypeId, Internal::IEventDispatcher*>;
@@ -70,7 +184,7 @@ namespace ECS { namespace Event {
 			}
 	
 		}
-	
+
 		// Remove event callback
 		inline void RemoveEventCallback(Internal::IEventDelegate* eventDelegate)
 		{
@@ -108,22 +222,32 @@ namespace ECS { namespace Event {
 			static_assert(std::is_trivially_copyable<E>::value, "Event is not trivially copyable.");
 	
 	
-			// allocate memory to store event data
-			void* pMem = this->m_EventMemoryAllocator->allocate(sizeof(E), alignof(E));
+			Internal::EventMemoryPages& eventMemoryPages = Internal::GetEventMemoryPages();
 
-			// add new event to buffer and event storage
-			if (pMem != nullptr)
-			{
-				this->m_EventStorage.push_back(new (pMem)E(std::forward<ARGS>(eventArgs)...));
+			// recycle the event memory pages, once all events buffered in them have been dispatched
+			if (this->m_EventStorage.empty() == true)
+				eventMemoryPages.clear();
 
-				LogTrace("\'%s\' event buffered.", typeid(E).name());
-			}
-			else
+			// allocate memory to store event data, continue on the event memory pages if the event buffer is full
+			void* pMem = this->m_EventMemoryAllocator->allocate(sizeof(E), alignof(E));
+			if (pMem == nullptr)
 			{
-				LogWarning("Event buffer is full! Cut off new incoming events !!!");
+				const size_t pageCount = eventMemoryPages.GetPageCount();
+
+				pMem = eventMemoryPages.allocate(sizeof(E), alignof(E));
+
+				if (eventMemoryPages.GetPageCount() != pageCount)
+					LogWarning("Event buffer is full! Added event memory page %d.", (int)eventMemoryPages.GetPageCount());
 			}
+
+			eventMemoryPages.UpdateHighWaterMark(this->m_EventMemoryAllocator->GetUsedMemory());
+
+			// add new event to buffer and event storage
+			this->m_EventStorage.push_back(new (pMem)E(std::forward<ARGS>(eventArgs)...));
+
+			LogTrace("\'%s\' event buffered.", typeid(E).name());
 		}
-	
+
 		// dispatches all stores events and clears buffer
 		void DispatchEvents()
 		{
@@ -31,6 +31,7 @@ namespace ECS { namespace Event {
 	
 			virtual void Dispatch(IEvent* event) = 0;
 	
+			// adds a callback, the dispatcher takes ownership of the delegate
 			virtual void AddEventCallback(IEventDelegate* const eventDelegate) = 0;
 	
 			virtual void RemoveEventCallback(IEventDelegate* eventDelegate) = 0;
@@ -59,7 +59,7 @@ namespace ECS
 			inline void RegisterEventCallback(void(C::*Callback)(const E* const))
 			{
 
-				Internal::IEventDelegate* eventDelegate = new Internal::EventDelegate<C, E>(static_cast<C*>(this), Callback);
+				Internal::IEventDelegate* eventDelegate = new Internal::EventDelegate<C, E>((C*)this, Callback);
 
 				m_RegisteredCallbacks.push_back(eventDelegate);
 				ECS_Engine->SubscribeEvent<E>(eventDelegate);
@@ -84,7 +84,7 @@ namespace ECS
 			template<class E, class C>
 			inline void UnregisterEventCallback(void(C::*Callback)(const E* const))
 			{	
-				Internal::EventDelegate<C, E> delegate(static_cast<C*>(this), Callback);
+				Internal::EventDelegate<C, E> delegate((C*)this, Callback);
 
 				for (auto cb : this->m_RegisteredCallbacks)
 				{
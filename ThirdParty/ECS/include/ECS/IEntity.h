@@ -46,23 +46,15 @@ namespace ECS
 		IEntity();
 		virtual ~IEntity();
 
+		// defined in 'ComponentManager.h', since ComponentManager is incomplete here
 		template<class T>
-		T* GetComponent() const
-		{
-			return this->m_ComponentManagerInstance->GetComponent<T>(this->m_EntityID);
-		}
+		T* GetComponent() const;
 
 		template<class T, class ...P>
-		T* AddComponent(P&&... param)
-		{
-			return this->m_ComponentManagerInstance->AddComponent<T>(this->m_EntityID, std::forward<P>(param)...);
-		}
+		T* AddComponent(P&&... param);
 
 		template<class T>
-		void RemoveComponent()
-		{
-			this->m_ComponentManagerInstance->RemoveComponent<T>(this->m_EntityID);
-		}
+		void RemoveComponent();
 
 		// COMPARE ENTITIES
 
@@ -45,6 +45,7 @@ namespace ECS
 	class ECS_API ISystem
 	{
 		friend class SystemManager;
+		friend class SystemScheduler;
 
 	private:
 
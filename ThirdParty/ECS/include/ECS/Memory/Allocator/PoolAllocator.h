@@ -27,7 +27,7 @@ namespace ECS { namespace Memory { namespace Allocator {
 
 	public:
 
-		PoolAllocator::PoolAllocator(size_t memSize, const void* mem, size_t objectSize, u8 objectAlignment);
+		PoolAllocator(size_t memSize, const void* mem, size_t objectSize, u8 objectAlignment);
 
 		virtual ~PoolAllocator();
 
@@ -1,15 +1,18 @@
 ///-------------------------------------------------------------------------------------------------
 /// File:	include\Memory\MemoryChunkAllocator.h.
 ///
-/// Summary:	Auxilary allocator class using base PoolAllocator. This allocator dynamically 
-/// creates memory chunks when out of capacity. Each memory chunk is managed by a single PoolAllocator.
+/// Summary:	Auxilary allocator class. This allocator dynamically creates memory chunks when out of
+/// capacity. Each chunk keeps a bitmap of its used object slots. Objects are always created in the
+/// lowest free slot, so used objects stay packed and iteration walks the slots in memory order.
 ///-------------------------------------------------------------------------------------------------
 
 #ifndef __MEMORY_CHUNK_ALLOCATOR_H__
 #define __MEMORY_CHUNK_ALLOCATOR_H__
 
 #include "API.h"
-#include "Memory/Allocator/PoolAllocator.h"
+#include "util/BitMask.h"
+
+#include <vector>
 
 
 namespace ECS { namespace Memory {
@@ -17,25 +20,22 @@ namespace ECS { namespace Memory {
 	template<class  OBJECT_TYPE, size_t MAX_CHUNK_OBJECTS>
 	class MemoryChunkAllocator : protected Memory::GlobalMemoryUser
 	{
-		static const size_t MAX_OBJECTS = typename MAX_CHUNK_OBJECTS;
+		static const size_t MAX_OBJECTS = MAX_CHUNK_OBJECTS;
 
-		/// Summary:	Byte size to fit approx. MAX_CHUNK_OBJECTS objects.
-		static const size_t ALLOC_SIZE = (sizeof(OBJECT_TYPE) + alignof(OBJECT_TYPE)) * MAX_OBJECTS;
+		/// Summary:	Number of 32 bit words of a chunk's slot occupancy bitmap.
+		static const size_t OCCUPANCY_WORDS = (MAX_OBJECTS + 31) / 32;
 
 		const char* m_AllocatorTag;
 
 	public:
 
-		using Allocator  = Memory::Allocator::PoolAllocator;
-		using ObjectList = std::list<OBJECT_TYPE*>;
-
-		
+		/// Summary:	Byte size to fit MAX_CHUNK_OBJECTS objects, plus padding to align the first object.
+		static const size_t ALLOC_SIZE = sizeof(OBJECT_TYPE) * MAX_OBJECTS + alignof(OBJECT_TYPE);
 
 		///-------------------------------------------------------------------------------------------------
 		/// class:	MemoryChunk
 		///
-		/// Summary:	Helper struct to capsule an allocator and object list. The object list is used to keep
-		/// track of objects start addresses in memory managed by the allocator.
+		/// Summary:	Chunk header. Keeps the chunk's memory and a bitmap of its used object slots.
 		///
 		/// Author:	Tobias Stein
 		///
@@ -46,28 +46,86 @@ namespace ECS { namespace Memory {
 		{
 		public:
 
-			Allocator*		allocator;
-			ObjectList		objects;
+			const void*		memory;
+			OBJECT_TYPE*	objects;
+
+			size_t			chunkIndex;
+			size_t			numObjects;
+
+			u32				occupied[OCCUPANCY_WORDS];
+
+			MemoryChunk(const void* mem, size_t index) :
+				memory(mem),
+				chunkIndex(index),
+				numObjects(0)
+			{
+				uptr adr = reinterpret_cast<uptr>(mem);
+				adr = (adr + (alignof(OBJECT_TYPE) - 1)) & ~(uptr)(alignof(OBJECT_TYPE) - 1);
+
+				this->objects = reinterpret_cast<OBJECT_TYPE*>(adr);
+
+				for (size_t w = 0; w < OCCUPANCY_WORDS; ++w)
+					this->occupied[w] = 0;
+			}
+
+			///-------------------------------------------------------------------------------------------------
+			/// Fn:	inline size_t MemoryChunk::FindUsedSlot(size_t first) const
+			///
+			/// Summary:	Returns the index of the first used slot at or after first, MAX_OBJECTS if there
+			/// is none.
+			///
+			/// Author:	Tobias Stein
+			///
+			/// Date:	17/10/2026
+			///-------------------------------------------------------------------------------------------------
+
+			inline size_t FindUsedSlot(size_t first) const
+			{
+				if (first >= MAX_OBJECTS)
+					return MAX_OBJECTS;
+
+				size_t w = first / 32;
+				u32 word = this->occupied[w] & (~0u << (first % 32));
+
+				while (word == 0)
+				{
+					if (++w == OCCUPANCY_WORDS)
+						return MAX_OBJECTS;
+
+					word = this->occupied[w];
+				}
+
+				return w * 32 + util::LowestSetBit(word);
+			}
+
+			// returns the index of the lowest free slot, the chunk must not be full
+			inline size_t FindFreeSlot() const
+			{
+				size_t w = 0;
+				while (this->occupied[w] == ~0u)
+					++w;
 
-			uptr			chunkStart;
-			uptr			chunkEnd;
+				return w * 32 + util::LowestSetBit(~this->occupied[w]);
+			}
 
-			MemoryChunk(Allocator* allocaor) :
-				allocator(allocaor)
+			// true, if object is stored in this chunk
+			inline bool Contains(const void* object) const
 			{
-				this->chunkStart = reinterpret_cast<uptr>(allocator->GetMemoryAddress0());
-				this->chunkEnd = this->chunkStart + ALLOC_SIZE;
-				this->objects.clear();
+				return ((object >= this->objects) && (object < this->objects + MAX_OBJECTS));
 			}
 
-		}; // class EntityMemoryChunk
+			inline void SetUsed(size_t i) { this->occupied[i / 32] |= (1u << (i % 32)); }
+			inline void SetFree(size_t i) { this->occupied[i / 32] &= ~(1u << (i % 32)); }
+
+		}; // class MemoryChunk
 
-		using MemoryChunks = std::list<MemoryChunk*>;
+		using MemoryChunks = std::vector<MemoryChunk*>;
 
 		///-------------------------------------------------------------------------------------------------
 		/// Class:	iterator
 		///
-		/// Summary:	An iterator for linear search actions in allocated memory chungs.
+		/// Summary:	An iterator over all used objects. Walks the chunks' slots in memory order and
+		/// skips free slots using the chunks' occupancy bitmaps.
 		///
 		/// Author:	Tobias Stein
 		///
@@ -76,105 +134,111 @@ namespace ECS { namespace Memory {
 
 		class iterator : public std::iterator<std::forward_iterator_tag, OBJECT_TYPE>
 		{
-			typename MemoryChunks::iterator	m_CurrentChunk;
-			typename MemoryChunks::iterator	m_End;
+			const MemoryChunks*	m_Chunks;
 
-			typename ObjectList::iterator	m_CurrentObject;
+			size_t				m_CurrentChunk;
+			size_t				m_CurrentSlot;
+
+			// moves to the first used slot at or after the current position
+			inline void Seek()
+			{
+				while (this->m_CurrentChunk < this->m_Chunks->size())
+				{
+					this->m_CurrentSlot = (*this->m_Chunks)[this->m_CurrentChunk]->FindUsedSlot(this->m_CurrentSlot);
+					if (this->m_CurrentSlot < MAX_OBJECTS)
+						return;
 
+					this->m_CurrentChunk++;
+					this->m_CurrentSlot = 0;
+				}
+			}
 
 			public:
 
-				iterator(typename MemoryChunks::iterator begin, typename MemoryChunks::iterator end) :
-					m_CurrentChunk(begin),
-					m_End(end)
-				{				
-					if (begin != end)
-					{	
-						assert((*m_CurrentChunk) != nullptr);
-						m_CurrentObject = (*m_CurrentChunk)->objects.begin();
-					}
-					else
-					{
-						m_CurrentObject = (*std::prev(m_End))->objects.end();
-					}
+				iterator(const MemoryChunks* chunks, size_t chunk) :
+					m_Chunks(chunks),
+					m_CurrentChunk(chunk),
+					m_CurrentSlot(0)
+				{
+					Seek();
 				}
-				
 
 				inline iterator& operator++()
 				{
-					// move to next object in current chunk
-					m_CurrentObject++;
-
-					// if we reached end of list, move to next chunk
-					if (m_CurrentObject == (*m_CurrentChunk)->objects.end())
-					{
-						m_CurrentChunk++;
-
-						if (m_CurrentChunk != m_End)
-						{
-							// set object iterator to begin of next chunk list
-							assert((*m_CurrentChunk) != nullptr);
-							m_CurrentObject = (*m_CurrentChunk)->objects.begin();
-						}
-					}
+					++m_CurrentSlot;
+					Seek();
 
 					return *this;
 				}
 
-				inline OBJECT_TYPE& operator*() const { return *m_CurrentObject; }
-				inline OBJECT_TYPE* operator->() const { return *m_CurrentObject; }
+				inline OBJECT_TYPE& operator*() const { return *operator->(); }
+				inline OBJECT_TYPE* operator->() const { return (*m_Chunks)[m_CurrentChunk]->objects + m_CurrentSlot; }
 
-				inline bool operator==(iterator& other) { return ((this->m_CurrentChunk == other.m_CurrentChunk) && (this->m_CurrentObject == other.m_CurrentObject));
-				}
-				inline bool operator!=(iterator& other) 
-				{ 
-					return ((this->m_CurrentChunk != other.m_CurrentChunk) && (this->m_CurrentObject != other.m_CurrentObject));
-				}
+				inline bool operator==(const iterator& other) const { return ((this->m_CurrentChunk == other.m_CurrentChunk) && (this->m_CurrentSlot == other.m_CurrentSlot)); }
+				inline bool operator!=(const iterator& other) const { return ((this->m_CurrentChunk != other.m_CurrentChunk) || (this->m_CurrentSlot != other.m_CurrentSlot)); }
 
 		}; // ComponentContainer::iterator
 
 	protected:
 
-		MemoryChunks m_Chunks;
+		MemoryChunks	m_Chunks;
+
+		/// Summary:	Index of the lowest chunk which may have free slots, chunks before it are full.
+		size_t			m_FreeChunk;
+
+		size_t			m_NumObjects;
+
+		/// Summary:	Incremented whenever an object is created or destroyed.
+		size_t			m_Version;
+
+	private:
+
+		void AddChunk()
+		{
+			MemoryChunk* chunk = new MemoryChunk(Allocate(ALLOC_SIZE, this->m_AllocatorTag), this->m_Chunks.size());
+			assert(chunk->memory != nullptr && "Unable to allocate new memory chunk. Out of memory?!");
+
+			this->m_Chunks.push_back(chunk);
+		}
 
 	public:
 
 
 		MemoryChunkAllocator(const char* allocatorTag = nullptr) :
-			m_AllocatorTag(allocatorTag)
+			m_AllocatorTag(allocatorTag),
+			m_FreeChunk(0),
+			m_NumObjects(0),
+			m_Version(0)
 		{
-			
-
 			// create initial chunk
-			Allocator* allocator = new Allocator(ALLOC_SIZE, Allocate(ALLOC_SIZE, allocatorTag), sizeof(OBJECT_TYPE), alignof(OBJECT_TYPE));
-			this->m_Chunks.push_back(new MemoryChunk(allocator));
+			AddChunk();
 		}
 
 		virtual ~MemoryChunkAllocator()
 		{
 			// make sure all entities will be released!
+			for (auto it = begin(); it != end(); ++it)
+				it->~OBJECT_TYPE();
+
 			for (auto chunk : this->m_Chunks)
 			{
-				for (auto obj : chunk->objects)
-					((OBJECT_TYPE*)obj)->~OBJECT_TYPE();
-		
-				chunk->objects.clear();
-
-				// free allocated allocator memory
-				Free((void*)chunk->allocator->GetMemoryAddress0());
-				delete chunk->allocator;
-				chunk->allocator = nullptr;
+				// free allocated chunk memory
+				Free((void*)chunk->memory);
 
 				// delete helper chunk object
 				delete chunk;
 				chunk = nullptr;
 			}
+
+			this->m_Chunks.clear();
 		}
 
 		///-------------------------------------------------------------------------------------------------
 		/// Fn:	inline void* MemoryChunkAllocator::CreateObject()
 		///
-		/// Summary:	Creates the object.
+		/// Summary:	Creates the object in the lowest free slot of the lowest chunk which is not full,
+		/// this keeps used objects packed at the front of the chunks. A new chunk is only allocated if all
+		/// chunks are full.
 		///
 		/// Author:	Tobias Stein
 		///
@@ -185,45 +249,31 @@ namespace ECS { namespace Memory {
 
 		void* CreateObject()
 		{
-			void* slot = nullptr;
-
-			// get next free slot
-			for (auto chunk : this->m_Chunks)
-			{
-				if (chunk->objects.size() > MAX_OBJECTS)
-					continue;
-
-				slot = chunk->allocator->allocate(sizeof(OBJECT_TYPE), alignof(OBJECT_TYPE));
-				if (slot != nullptr)
-				{
-					chunk->objects.push_back((OBJECT_TYPE*)slot);
-					break;
-				}
-			}
+			while (this->m_FreeChunk < this->m_Chunks.size() && this->m_Chunks[this->m_FreeChunk]->numObjects == MAX_OBJECTS)
+				this->m_FreeChunk++;
 
 			// all chunks are full... allocate a new one
-			if (slot == nullptr)
-			{
-				Allocator* allocator = new Allocator(ALLOC_SIZE, Allocate(ALLOC_SIZE, this->m_AllocatorTag), sizeof(OBJECT_TYPE), alignof(OBJECT_TYPE));
-				MemoryChunk* newChunk = new MemoryChunk(allocator);		
+			if (this->m_FreeChunk == this->m_Chunks.size())
+				AddChunk();
 
-				// put new chunk in front
-				this->m_Chunks.push_front(newChunk);
+			MemoryChunk* chunk = this->m_Chunks[this->m_FreeChunk];
 
-				slot = newChunk->allocator->allocate(sizeof(OBJECT_TYPE), alignof(OBJECT_TYPE));
+			const size_t slot = chunk->FindFreeSlot();
 
-				assert(slot != nullptr && "Unable to create new object. Out of memory?!");
-				newChunk->objects.clear();
-				newChunk->objects.push_back((OBJECT_TYPE*)slot);
-			}
+			chunk->SetUsed(slot);
+			chunk->numObjects++;
+
+			this->m_NumObjects++;
+			this->m_Version++;
 
-			return slot;
+			return chunk->objects + slot;
 		}
 
 		///-------------------------------------------------------------------------------------------------
 		/// Fn:	inline void MemoryChunkAllocator::DestroyObject(void* object)
 		///
-		/// Summary:	Destroys the object.
+		/// Summary:	Destroys the object. The object's chunk is found by its address, the slot index
+		/// is the object's offset in the chunk.
 		///
 		/// Author:	Tobias Stein
 		///
@@ -235,26 +285,37 @@ namespace ECS { namespace Memory {
 
 		void DestroyObject(void* object)
 		{
-			uptr adr = reinterpret_cast<uptr>(object);
+			// note: no need to call d'tor since it was called already by 'delete'
 
-			for (auto chunk : this->m_Chunks)
-			{
-				if (chunk->chunkStart <= adr && adr < chunk->chunkEnd)
-				{
-					// note: no need to call d'tor since it was called already by 'delete'
+			// note: there are only a few chunks, since each holds MAX_CHUNK_OBJECTS objects
+			size_t c = 0;
+			while (c < this->m_Chunks.size() && this->m_Chunks[c]->Contains(object) == false)
+				++c;
 
-					chunk->objects.remove((OBJECT_TYPE*)object);
-					chunk->allocator->free(object);
-					return;
-				}
-			}
+			assert(c < this->m_Chunks.size() && "Failed to delete object. Memory corruption?!");
+
+			MemoryChunk* chunk = this->m_Chunks[c];
+
+			const size_t slot = reinterpret_cast<OBJECT_TYPE*>(object) - chunk->objects;
+
+			assert(chunk->FindUsedSlot(slot) == slot && "Failed to delete object. Memory corruption?!");
 
-			assert(false && "Failed to delete object. Memory corruption?!");
+			chunk->SetFree(slot);
+			chunk->numObjects--;
+
+			this->m_NumObjects--;
+			this->m_Version++;
+
+			if (chunk->chunkIndex < this->m_FreeChunk)
+				this->m_FreeChunk = chunk->chunkIndex;
 		}
 
+		inline size_t size() const { return this->m_NumObjects; }
+
+		inline size_t GetVersion() const { return this->m_Version; }
 
-		inline iterator begin() { return iterator(this->m_Chunks.begin(), this->m_Chunks.end()); }
-		inline iterator end() { return iterator(this->m_Chunks.end(), this->m_Chunks.end()); }
+		inline iterator begin() { return iterator(&this->m_Chunks, 0); }
+		inline iterator end() { return iterator(&this->m_Chunks, this->m_Chunks.size()); }
 
 	}; // MemoryChunkAllocator 
 
@@ -9,11 +9,16 @@
 #define __PLATFORM_H__
 
 
-#ifdef ECS_EXPORT  
-	#define ECS_API __declspec(dllexport)   
-#else  
-	#define ECS_API __declspec(dllimport)   
-#endif  
+#if defined(_WIN32)
+	#ifdef ECS_EXPORT  
+		#define ECS_API __declspec(dllexport)   
+	#else  
+		#define ECS_API __declspec(dllimport)   
+	#endif  
+#else
+	// non-windows platforms export all symbols by default
+	#define ECS_API
+#endif
 
 
 // Check if using 64-Bit architecture
@@ -31,6 +36,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdint.h>
+#include <limits.h>
 #include <limits>
 
 #include <vector>
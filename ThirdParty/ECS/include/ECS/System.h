@@ -14,6 +14,7 @@
 #include "API.h"
 
 #include "ISystem.h"
+#include "SystemScheduler.h"
 #include "util/FamilyTypeID.h"
 
 
@@ -83,6 +84,43 @@ namespace ECS
 			this->m_SystemManagerInstance->AddSystemDependency(this, std::forward<Dependencies>(dependencies)...);
 		}
 
+		///-------------------------------------------------------------------------------------------------
+		/// Fn:	template<class... C> void System::ReadsComponents()
+		///
+		/// Summary:	Declares that this system reads components of types C during its update. Only
+		/// systems which have declared their access (ReadsComponents, WritesComponents, WritesSystems)
+		/// may be updated concurrently with other systems, see SystemScheduler.
+		/// Such a system must not send events, create or destroy entities or add or remove components
+		/// during its update, and must not touch any state which is not covered by its declaration.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///
+		/// Typeparams:
+		/// C - 	Component types.
+		///-------------------------------------------------------------------------------------------------
+
+		template<class... C>
+		void ReadsComponents()
+		{
+			SystemScheduler::AddSystemReadComponents<T, C...>();
+		}
+
+		// declares that this system writes components of types C during its update, see ReadsComponents
+		template<class... C>
+		void WritesComponents()
+		{
+			SystemScheduler::AddSystemWriteComponents<T, C...>();
+		}
+
+		// declares that this system calls into systems of types S and changes their state, see ReadsComponents
+		template<class... S>
+		void WritesSystems()
+		{
+			SystemScheduler::AddSystemWriteSystems<T, S...>();
+		}
+
 		virtual void PreUpdate(f32 dt) override
 		{}
 
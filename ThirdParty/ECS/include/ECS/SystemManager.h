@@ -29,6 +29,7 @@ namespace ECS
 	class ECS_API SystemManager : Memory::GlobalMemoryUser
 	{
 		friend ECSEngine;
+		friend class SystemScheduler;
 
 		DECLARE_LOGGER
 
@@ -264,6 +265,14 @@ namespace ECS
 			}
 		}
 
+		template<class T>
+		bool IsSystemEnabled() const
+		{
+			auto it = this->m_Systems.find(T::STATIC_SYSTEM_TYPE_ID);
+
+			return it != this->m_Systems.end() && it->second->m_Enabled == true;
+		}
+
 		template<class T>
 		void SetSystemUpdateInterval(f32 interval_ms)
 		{
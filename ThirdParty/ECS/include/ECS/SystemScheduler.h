@@ -0,0 +1,468 @@
+/*
+	Author : Tobias Stein
+	Date   : 17th October, 2026
+	File   : SystemScheduler.h
+
+	Updates independent systems concurrently on a pool of worker threads.
+
+	All Rights Reserved. (c) Copyright 2016 - 2017.
+*/
+
+#ifndef __SYSTEM_SCHEDULER_H__
+#define __SYSTEM_SCHEDULER_H__
+
+#include "API.h"
+
+#include "ISystem.h"
+#include "SystemManager.h"
+#include "util/BitMask.h"
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace ECS
+{
+	///-------------------------------------------------------------------------------------------------
+	/// Struct:	SystemAccess
+	///
+	/// Summary:	The component types a system reads and writes during its update, and the systems it
+	/// calls into. A system which has not declared its access conflicts with every other system.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	struct SystemAccess
+	{
+		using ComponentMask	= util::BitMask<MAX_COMPONENT_TYPES>;
+		using SystemMask	= util::BitMask<MAX_SYSTEM_TYPES>;
+
+		ComponentMask	m_ReadComponents;
+		ComponentMask	m_WriteComponents;
+
+		// systems whose state is changed, always contains the system itself
+		SystemMask		m_WriteSystems;
+
+		bool			m_Declared;
+
+		SystemAccess() :
+			m_Declared(false)
+		{}
+
+		inline bool ConflictsWith(const SystemAccess& other) const
+		{
+			if (this->m_Declared == false || other.m_Declared == false)
+				return true;
+
+			return this->m_WriteComponents.Intersects(other.m_ReadComponents)
+				|| this->m_WriteComponents.Intersects(other.m_WriteComponents)
+				|| other.m_WriteComponents.Intersects(this->m_ReadComponents)
+				|| this->m_WriteSystems.Intersects(other.m_WriteSystems);
+		}
+	};
+
+	///-------------------------------------------------------------------------------------------------
+	/// Class:	SystemScheduler
+	///
+	/// Summary:	Runs the PreUpdate, Update and PostUpdate pass of all systems as a task graph. Within
+	/// a pass a system waits for every earlier system in the work order which it depends on or whose
+	/// access conflicts with its own, all other systems run concurrently. Systems without declared
+	/// access always run on the calling (main) thread, so thread affine systems like rendering and
+	/// input stay where they are.
+	///
+	/// The ECS library's ECSEngine::Update runs its own serial system update, dispatches events and
+	/// removes destroyed entities. So a scheduler is updated right before ECSEngine::Update and, while
+	/// it exists, keeps the update interval of all systems at 0, which makes the library's update skip
+	/// them. The intervals are restored when the scheduler is destroyed, so set them before creating
+	/// a scheduler. Enabling and disabling systems works as before.
+	///
+	/// Author:	Tobias Stein
+	///
+	/// Date:	17/10/2026
+	///-------------------------------------------------------------------------------------------------
+
+	class SystemScheduler
+	{
+	public:
+
+		using SystemWorkOrder			= std::vector<ISystem*>;
+		using SystemDependencyMatrix	= std::vector<std::vector<bool>>;
+		using SystemAccessTable			= std::vector<SystemAccess>;
+
+	private:
+
+		// declared access of each system, indexed by system type id. Note: systems declare their access in
+		// their constructor, before the system manager adds them to the work order
+		static SystemAccessTable& GetSystemAccessTable()
+		{
+			static SystemAccessTable SYSTEM_ACCESS_TABLE;
+			return SYSTEM_ACCESS_TABLE;
+		}
+
+		static SystemAccess& GetSystemAccess(const SystemTypeId systemTypeId)
+		{
+			SystemAccessTable& access = GetSystemAccessTable();
+
+			if (systemTypeId >= access.size())
+				access.resize(systemTypeId + 1);
+
+			return access[systemTypeId];
+		}
+
+		enum SystemPass
+		{
+			PRE_UPDATE = 0,
+			UPDATE,
+			POST_UPDATE
+		};
+
+		struct SystemTask
+		{
+			ISystem*				m_System;
+
+			// the system's own update interval, while the library sees 0
+			f32						m_UpdateInterval;
+
+			// tasks which have to wait for this task
+			std::vector<size_t>		m_Successors;
+
+			size_t					m_NumPredecessors;
+
+			// false if the system has to run on the main thread
+			bool					m_Concurrent;
+		};
+
+		using SystemTasks = std::vector<SystemTask>;
+		using TaskQueue = std::vector<size_t>;
+
+		SystemManager*				m_SystemManagerInstance;
+
+		SystemTasks					m_Tasks;
+
+		// work order and dependencies the tasks were built for
+		SystemWorkOrder				m_TaskWorkOrder;
+		SystemDependencyMatrix		m_TaskDependencies;
+
+		std::vector<std::thread>	m_Workers;
+
+		std::mutex					m_Mutex;
+		std::condition_variable		m_Signal;
+
+		// ready tasks, which may run on any thread
+		TaskQueue					m_ReadyTasks;
+
+		// ready tasks, which have to run on the main thread
+		TaskQueue					m_ReadyMainTasks;
+
+		std::vector<size_t>			m_PendingPredecessors;
+		size_t						m_NumFinishedTasks;
+
+		SystemPass					m_Pass;
+		f32							m_DeltaTime;
+
+		bool						m_Shutdown;
+
+		SystemScheduler(const SystemScheduler&) = delete;
+		SystemScheduler& operator=(SystemScheduler&) = delete;
+
+		void Build(const SystemWorkOrder& workOrder, const SystemDependencyMatrix& dependencies)
+		{
+			static const SystemAccess UNDECLARED_ACCESS;
+
+			const SystemAccessTable& access = GetSystemAccessTable();
+
+			const size_t N = workOrder.size();
+
+			// keep the intervals of systems, which have already been taken over
+			SystemTasks oldTasks;
+			oldTasks.swap(this->m_Tasks);
+
+			this->m_Tasks.resize(N);
+
+			auto GetAccess = [&](ISystem* system) -> const SystemAccess&
+			{
+				const SystemTypeId STID = system->GetStaticSystemTypeID();
+				return STID < access.size() ? access[STID] : UNDECLARED_ACCESS;
+			};
+
+			auto DependsOn = [&](ISystem* target, ISystem* dependency)
+			{
+				const SystemTypeId TARGET_ID = target->GetStaticSystemTypeID();
+				const SystemTypeId DEPEND_ID = dependency->GetStaticSystemTypeID();
+
+				return TARGET_ID < dependencies.size() && DEPEND_ID < dependencies[TARGET_ID].size() && dependencies[TARGET_ID][DEPEND_ID] == true;
+			};
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				this->m_Tasks[i].m_System = workOrder[i];
+				this->m_Tasks[i].m_NumPredecessors = 0;
+				this->m_Tasks[i].m_Concurrent = GetAccess(workOrder[i]).m_Declared;
+
+				auto old = std::find_if(oldTasks.begin(), oldTasks.end(), [&](const SystemTask& task) { return task.m_System == workOrder[i]; });
+				if (old != oldTasks.end())
+				{
+					this->m_Tasks[i].m_UpdateInterval = old->m_UpdateInterval;
+				}
+				else
+				{
+					this->m_Tasks[i].m_UpdateInterval = workOrder[i]->m_UpdateInterval;
+					workOrder[i]->m_UpdateInterval = 0.0f;
+				}
+			}
+
+			// note: edges always point forward in the work order, so the task graph is acyclic and the
+			// result is the same as a serial update in work order
+			for (size_t i = 0; i < N; ++i)
+			{
+				for (size_t j = i + 1; j < N; ++j)
+				{
+					if (DependsOn(workOrder[j], workOrder[i]) || DependsOn(workOrder[i], workOrder[j]) || GetAccess(workOrder[i]).ConflictsWith(GetAccess(workOrder[j])))
+					{
+						this->m_Tasks[i].m_Successors.push_back(j);
+						this->m_Tasks[j].m_NumPredecessors++;
+					}
+				}
+			}
+
+			this->m_TaskWorkOrder = workOrder;
+			this->m_TaskDependencies = dependencies;
+
+			this->m_PendingPredecessors.resize(N);
+		}
+
+		inline void RunTask(size_t task)
+		{
+			ISystem* system = this->m_Tasks[task].m_System;
+
+			if (system->m_Enabled == false || system->m_NeedsUpdate == false)
+				return;
+
+			switch (this->m_Pass)
+			{
+				case PRE_UPDATE:
+					system->PreUpdate(this->m_DeltaTime);
+					break;
+
+				case UPDATE:
+					system->Update(this->m_DeltaTime);
+
+					// reset interval since last update
+					system->m_TimeSinceLastUpdate = 0.0f;
+					break;
+
+				case POST_UPDATE:
+					system->PostUpdate(this->m_DeltaTime);
+					break;
+			}
+		}
+
+		// note: must be called with m_Mutex locked
+		inline void PushReadyTask(size_t task)
+		{
+			if (this->m_Tasks[task].m_Concurrent == true)
+				this->m_ReadyTasks.push_back(task);
+			else
+				this->m_ReadyMainTasks.push_back(task);
+		}
+
+		// takes the ready task which comes first in the work order. Note: must be called with m_Mutex locked
+		static inline size_t PopReadyTask(TaskQueue& queue)
+		{
+			auto first = std::min_element(queue.begin(), queue.end());
+
+			const size_t task = *first;
+			queue.erase(first);
+
+			return task;
+		}
+
+		// note: must be called with m_Mutex locked
+		inline void CompleteTask(size_t task)
+		{
+			for (size_t successor : this->m_Tasks[task].m_Successors)
+			{
+				if (--this->m_PendingPredecessors[successor] == 0)
+					PushReadyTask(successor);
+			}
+
+			this->m_NumFinishedTasks++;
+
+			this->m_Signal.notify_all();
+		}
+
+		void WorkerLoop()
+		{
+			std::unique_lock<std::mutex> lock(this->m_Mutex);
+
+			while (true)
+			{
+				this->m_Signal.wait(lock, [this] { return this->m_Shutdown == true || this->m_ReadyTasks.empty() == false; });
+
+				if (this->m_Shutdown == true)
+					return;
+
+				const size_t task = PopReadyTask(this->m_ReadyTasks);
+
+				lock.unlock();
+				RunTask(task);
+				lock.lock();
+
+				CompleteTask(task);
+			}
+		}
+
+		void RunPass(SystemPass pass)
+		{
+			std::unique_lock<std::mutex> lock(this->m_Mutex);
+
+			this->m_Pass = pass;
+			this->m_NumFinishedTasks = 0;
+
+			for (size_t i = 0; i < this->m_Tasks.size(); ++i)
+			{
+				this->m_PendingPredecessors[i] = this->m_Tasks[i].m_NumPredecessors;
+				if (this->m_PendingPredecessors[i] == 0)
+					PushReadyTask(i);
+			}
+
+			this->m_Signal.notify_all();
+
+			// main thread runs main thread tasks and helps with concurrent tasks until all tasks are done
+			while (this->m_NumFinishedTasks < this->m_Tasks.size())
+			{
+				TaskQueue* queue = this->m_ReadyMainTasks.empty() == false ? &this->m_ReadyMainTasks : (this->m_ReadyTasks.empty() == false ? &this->m_ReadyTasks : nullptr);
+				if (queue == nullptr)
+				{
+					this->m_Signal.wait(lock);
+					continue;
+				}
+
+				const size_t task = PopReadyTask(*queue);
+
+				lock.unlock();
+				RunTask(task);
+				lock.lock();
+
+				CompleteTask(task);
+			}
+		}
+
+	public:
+
+		SystemScheduler(SystemManager* systemManager, size_t numWorkers) :
+			m_SystemManagerInstance(systemManager),
+			m_NumFinishedTasks(0),
+			m_Pass(PRE_UPDATE),
+			m_DeltaTime(0.0f),
+			m_Shutdown(false)
+		{
+			for (size_t i = 0; i < numWorkers; ++i)
+				this->m_Workers.emplace_back(&SystemScheduler::WorkerLoop, this);
+		}
+
+		~SystemScheduler()
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->m_Mutex);
+				this->m_Shutdown = true;
+			}
+
+			this->m_Signal.notify_all();
+
+			for (auto& worker : this->m_Workers)
+				worker.join();
+
+			this->m_Workers.clear();
+
+			// hand the systems back to the library's update
+			for (auto& task : this->m_Tasks)
+				task.m_System->m_UpdateInterval = task.m_UpdateInterval;
+		}
+
+		template<class S, class... C>
+		static void AddSystemReadComponents()
+		{
+			SystemAccess& access = GetSystemAccess(S::STATIC_SYSTEM_TYPE_ID);
+
+			access.m_Declared = true;
+			access.m_WriteSystems.Set(S::STATIC_SYSTEM_TYPE_ID);
+
+			using expand = int[];
+			(void)expand { 0, (access.m_ReadComponents.Set(C::STATIC_COMPONENT_TYPE_ID), 0)... };
+		}
+
+		template<class S, class... C>
+		static void AddSystemWriteComponents()
+		{
+			SystemAccess& access = GetSystemAccess(S::STATIC_SYSTEM_TYPE_ID);
+
+			access.m_Declared = true;
+			access.m_WriteSystems.Set(S::STATIC_SYSTEM_TYPE_ID);
+
+			using expand = int[];
+			(void)expand { 0, (access.m_WriteComponents.Set(C::STATIC_COMPONENT_TYPE_ID), 0)... };
+		}
+
+		template<class S, class... Systems>
+		static void AddSystemWriteSystems()
+		{
+			SystemAccess& access = GetSystemAccess(S::STATIC_SYSTEM_TYPE_ID);
+
+			access.m_Declared = true;
+			access.m_WriteSystems.Set(S::STATIC_SYSTEM_TYPE_ID);
+
+			using expand = int[];
+			(void)expand { 0, (access.m_WriteSystems.Set(Systems::STATIC_SYSTEM_TYPE_ID), 0)... };
+		}
+
+		inline size_t GetNumWorkers() const { return this->m_Workers.size(); }
+
+		///-------------------------------------------------------------------------------------------------
+		/// Fn:	void SystemScheduler::Update(f32 dt_ms)
+		///
+		/// Summary:	Updates all systems, same as SystemManager's serial update but independent systems
+		/// are updated concurrently. The task graph is re-built if the work order or the system
+		/// dependencies changed. Call right before ECSEngine::Update.
+		///
+		/// Author:	Tobias Stein
+		///
+		/// Date:	17/10/2026
+		///
+		/// Parameters:
+		/// dt_ms - 	The dt in milliseconds.
+		///-------------------------------------------------------------------------------------------------
+
+		void Update(f32 dt_ms)
+		{
+			const SystemWorkOrder& workOrder = this->m_SystemManagerInstance->m_SystemWorkOrder;
+			const SystemDependencyMatrix& dependencies = this->m_SystemManagerInstance->m_SystemDependencyMatrix;
+
+			if (this->m_TaskWorkOrder != workOrder || this->m_TaskDependencies != dependencies)
+				Build(workOrder, dependencies);
+
+			this->m_DeltaTime = dt_ms;
+
+			// note: the library's update advances the time since last update of all systems after the
+			// previous tick, so it already contains dt_ms here
+			for (auto& task : this->m_Tasks)
+			{
+				ISystem* system = task.m_System;
+
+				// check systems update state
+				system->m_NeedsUpdate = (task.m_UpdateInterval < 0.0f) || ((task.m_UpdateInterval > 0.0f) && (system->m_TimeSinceLastUpdate > task.m_UpdateInterval));
+			}
+
+			RunPass(PRE_UPDATE);
+			RunPass(UPDATE);
+			RunPass(POST_UPDATE);
+		}
+	};
+
+} // namespace ECS
+
+#endif // __SYSTEM_SCHEDULER_H__
@@ -0,0 +1,72 @@
+/*
+	Author : Tobias Stein
+	Date   : 17th October, 2026
+	File   : BitMask.h
+
+	Fixed size bit mask.
+
+	All Rights Reserved. (c) Copyright 2016 - 2017.
+*/
+
+#ifndef __BIT_MASK_H__
+#define __BIT_MASK_H__
+
+#include "API.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace ECS { namespace util {
+
+	// index of the lowest set bit, word must not be 0
+	inline u32 LowestSetBit(u32 word)
+	{
+	#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, word);
+		return (u32)index;
+	#else
+		return (u32)__builtin_ctz(word);
+	#endif
+	}
+
+	template<size_t NUM_BITS>
+	class BitMask
+	{
+		static const size_t NUM_WORDS = (NUM_BITS + 31) / 32;
+
+		u32 m_Words[NUM_WORDS];
+
+	public:
+
+		BitMask()
+		{
+			Clear();
+		}
+
+		inline void Set(size_t i) { this->m_Words[i / 32] |= (1u << (i % 32)); }
+		inline void Reset(size_t i) { this->m_Words[i / 32] &= ~(1u << (i % 32)); }
+
+		inline bool Test(size_t i) const { return (this->m_Words[i / 32] & (1u << (i % 32))) != 0; }
+
+		// true if any bit is set in both masks
+		inline bool Intersects(const BitMask& other) const
+		{
+			for (size_t w = 0; w < NUM_WORDS; ++w)
+				if ((this->m_Words[w] & other.m_Words[w]) != 0)
+					return true;
+
+			return false;
+		}
+
+		inline void Clear()
+		{
+			for (size_t w = 0; w < NUM_WORDS; ++w)
+				this->m_Words[w] = 0;
+		}
+	};
+
+}} // namespace ECS::util
+
+#endif // __BIT_MASK_H__
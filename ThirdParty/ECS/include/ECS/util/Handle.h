@@ -47,8 +47,8 @@ namespace ECS { namespace util {
 
 
 			static constexpr value_type		MIN_VERISON			{ 0 };
-			static constexpr value_type		MAX_VERSION			{ (1U << NUM_VERSION_BITS) - 2U };
-			static constexpr value_type		MAX_INDICES			{ (1U << NUM_INDEX_BITS)   - 2U };
+			static constexpr value_type		MAX_VERSION			{ (value_type(1) << NUM_VERSION_BITS) - 2U };
+			static constexpr value_type		MAX_INDICES			{ (value_type(1) << NUM_INDEX_BITS)   - 2U };
 
 			static constexpr value_type		INVALID_HANDLE		{ std::numeric_limits<value_type>::max() };
 
@@ -162,6 +162,7 @@ namespace ECS { namespace util {
 		void ReleaseHandle(Handle handle)
 		{
 			assert((handle.index < this->m_Table.size() && handle.version == this->m_Table[handle.index].first) && "Invalid handle!");
+			assert(this->m_Table[handle.index].second != nullptr && "Handle already released!");
 			this->m_Table[handle.index].second = nullptr;
 		}
 